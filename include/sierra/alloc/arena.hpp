@@ -0,0 +1,361 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_ALLOC_ARENA_HPP
+#define SRR_ALLOC_ARENA_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace alloc {
+
+class Arena;
+
+namespace impl {
+
+struct ArenaChunk {
+    ArenaChunk *next;
+    usize       size;
+};
+
+constexpr usize ARENA_DEFAULT_CHUNK = 64ULL * 1024ULL;
+constexpr usize ARENA_HEADER =
+    (sizeof(ArenaChunk) + alignof(std::max_align_t) - 1) &
+    ~(alignof(std::max_align_t) - 1);
+
+[[nodiscard]] static std::byte *chunkData(ArenaChunk *chunk) noexcept;
+[[nodiscard]] static std::byte *chunkEnd(ArenaChunk *chunk) noexcept;
+[[nodiscard]] static usize      alignPadding(const std::byte *ptr,
+                                             usize            align) noexcept;
+
+} // namespace impl
+
+struct ArenaMarker {
+    impl::ArenaChunk *chunk;
+    std::byte        *cursor;
+};
+
+// Monotonic allocator, allocation bumps a cursor through a chain of chunks.
+// Memory is only reclaimed by rewinding to a marker or resetting, chunks are
+// kept for reuse until release() or destruction. Destructors of objects
+// placed in the arena are never run, see create().
+class Arena {
+public:
+    [[nodiscard]] Arena() noexcept;
+    [[nodiscard]] explicit Arena(usize chunk_size) noexcept;
+    [[nodiscard]] Arena(Arena &&arena) noexcept;
+
+    Arena(const Arena &arena)            = delete;
+    Arena &operator=(const Arena &arena) = delete;
+    Arena &operator=(Arena &&arena)      = delete;
+
+    ~Arena() noexcept;
+
+    // align must be a power of two.
+    [[nodiscard]] Result<void *> allocate(usize size, usize align) noexcept;
+
+    template<typename T>
+    [[nodiscard]] Result<T *> allocate(usize count) noexcept;
+
+    template<typename T, typename... Args>
+        requires std::is_trivially_destructible_v<T> &&
+                 std::is_nothrow_constructible_v<T, Args...>
+    [[nodiscard]] Result<T *> create(Args &&...args) noexcept;
+
+    [[nodiscard]] ArenaMarker mark() const noexcept;
+    void                      rewind(ArenaMarker marker) noexcept;
+    void                      reset() noexcept;
+    void                      release() noexcept;
+
+    [[nodiscard]] usize       chunkSize() const noexcept;
+    [[nodiscard]] usize       reserved() const noexcept;
+
+private:
+    [[nodiscard]] Result<void *> allocateSlow(usize size, usize align) noexcept;
+
+    impl::ArenaChunk            *head_;
+    impl::ArenaChunk            *current_;
+    std::byte                   *cursor_;
+    std::byte                   *end_;
+    usize                        chunk_size_;
+};
+
+// Rewinds the arena to its state at construction when leaving the scope.
+class ArenaScope {
+public:
+    [[nodiscard]] explicit ArenaScope(Arena &arena) noexcept;
+
+    ArenaScope(const ArenaScope &scope)            = delete;
+    ArenaScope(ArenaScope &&scope)                 = delete;
+    ArenaScope &operator=(const ArenaScope &scope) = delete;
+    ArenaScope &operator=(ArenaScope &&scope)      = delete;
+
+    ~ArenaScope() noexcept;
+
+private:
+    Arena      &arena_;
+    ArenaMarker marker_;
+};
+
+// Standard Allocator over an Arena so standard containers can draw from it.
+// deallocate() is a no-op, memory returns with the arena. Running out of
+// memory aborts, as std::allocator does without exceptions.
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T; // NOLINT(readability-identifier-naming)
+
+    [[nodiscard]] explicit ArenaAllocator(Arena &arena) noexcept;
+
+    template<typename U>
+    [[nodiscard]] ArenaAllocator(const ArenaAllocator<U> &other) noexcept;
+
+    [[nodiscard]] T *allocate(usize count) noexcept;
+    void             deallocate(T *ptr, usize count) noexcept;
+
+    [[nodiscard]] Arena &arena() const noexcept;
+
+    template<typename U>
+    [[nodiscard]] bool operator==(const ArenaAllocator<U> &rhs) const noexcept;
+
+private:
+    Arena *arena_;
+};
+
+namespace impl {
+
+// Chunk layout is a header followed by its data, the byte views below are the
+// only place the arena looks through raw addresses.
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+static std::byte *chunkData(ArenaChunk *chunk) noexcept {
+    return reinterpret_cast<std::byte *>(chunk) + ARENA_HEADER;
+}
+
+static std::byte *chunkEnd(ArenaChunk *chunk) noexcept {
+    return chunkData(chunk) + chunk->size;
+}
+
+static usize alignPadding(const std::byte *ptr, usize align) noexcept {
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(ptr);
+    return (align - (addr & (align - 1))) & (align - 1);
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+} // namespace impl
+
+inline Arena::Arena() noexcept : Arena{ impl::ARENA_DEFAULT_CHUNK } {}
+
+inline Arena::Arena(usize chunk_size) noexcept :
+    head_{ nullptr },
+    current_{ nullptr },
+    cursor_{ nullptr },
+    end_{ nullptr },
+    chunk_size_{ chunk_size } {}
+
+inline Arena::Arena(Arena &&arena) noexcept :
+    head_{ std::exchange(arena.head_, nullptr) },
+    current_{ std::exchange(arena.current_, nullptr) },
+    cursor_{ std::exchange(arena.cursor_, nullptr) },
+    end_{ std::exchange(arena.end_, nullptr) },
+    chunk_size_{ arena.chunk_size_ } {}
+
+inline Arena::~Arena() noexcept { release(); }
+
+inline Result<void *> Arena::allocate(usize size, usize align) noexcept {
+    const usize padding = impl::alignPadding(cursor_, align);
+    const usize avail   = static_cast<usize>(end_ - cursor_);
+
+    // size + padding could wrap for sizes near USIZE_MAX, compare apart.
+    if (cursor_ != nullptr && padding <= avail && size <= avail - padding) {
+        std::byte *ptr = cursor_ + padding;
+        cursor_        = ptr + size;
+        return static_cast<void *>(ptr);
+    }
+
+    return allocateSlow(size, align);
+}
+
+template<typename T>
+Result<T *> Arena::allocate(usize count) noexcept {
+    if (count > USIZE_MAX / sizeof(T)) return Err::OUT_OF_MEMORY;
+
+    Result<void *> raw = allocate(count * sizeof(T), alignof(T));
+    if (raw.bad()) return raw.err();
+
+    return static_cast<T *>(raw.val());
+}
+
+template<typename T, typename... Args>
+    requires std::is_trivially_destructible_v<T> &&
+             std::is_nothrow_constructible_v<T, Args...>
+Result<T *> Arena::create(Args &&...args) noexcept {
+    Result<void *> raw = allocate(sizeof(T), alignof(T));
+    if (raw.bad()) return raw.err();
+
+    return std::construct_at(static_cast<T *>(raw.val()),
+                             std::forward<Args>(args)...);
+}
+
+inline ArenaMarker Arena::mark() const noexcept {
+    return { .chunk = current_, .cursor = cursor_ };
+}
+
+inline void Arena::rewind(ArenaMarker marker) noexcept {
+    if (marker.chunk == nullptr) {
+        reset();
+        return;
+    }
+
+    current_ = marker.chunk;
+    cursor_  = marker.cursor;
+    end_     = impl::chunkEnd(marker.chunk);
+}
+
+inline void Arena::reset() noexcept {
+    current_ = head_;
+    cursor_  = head_ != nullptr ? impl::chunkData(head_) : nullptr;
+    end_     = head_ != nullptr ? impl::chunkEnd(head_) : nullptr;
+}
+
+inline void Arena::release() noexcept {
+    impl::ArenaChunk *chunk = head_;
+    while (chunk != nullptr) {
+        impl::ArenaChunk *next = chunk->next;
+        std::destroy_at(chunk);
+        ::operator delete(chunk);
+        chunk = next;
+    }
+
+    head_    = nullptr;
+    current_ = nullptr;
+    cursor_  = nullptr;
+    end_     = nullptr;
+}
+
+inline usize Arena::chunkSize() const noexcept { return chunk_size_; }
+
+inline usize Arena::reserved() const noexcept {
+    usize total = 0;
+    for (const impl::ArenaChunk *chunk = head_; chunk != nullptr;
+         chunk                         = chunk->next)
+        total += chunk->size;
+
+    return total;
+}
+
+inline Result<void *> Arena::allocateSlow(usize size, usize align) noexcept {
+    // Chunk data is only max_align_t aligned, over-allocate for the rest.
+    if (size > USIZE_MAX - align - impl::ARENA_HEADER)
+        return Err::OUT_OF_MEMORY;
+
+    const usize need = size + align - 1;
+
+    // Chunks past the cursor survive a rewind, reuse them before growing.
+    impl::ArenaChunk *next = current_ != nullptr ? current_->next : head_;
+
+    if (next == nullptr || next->size < need) {
+        const usize bytes = std::max(chunk_size_, need);
+        void       *block =
+            ::operator new(impl::ARENA_HEADER + bytes, std::nothrow);
+        if (block == nullptr) return Err::OUT_OF_MEMORY;
+
+        impl::ArenaChunk *chunk = std::construct_at(
+            static_cast<impl::ArenaChunk *>(block),
+            impl::ArenaChunk{ .next = next, .size = bytes });
+
+        if (current_ != nullptr)
+            current_->next = chunk;
+        else
+            head_ = chunk;
+
+        next = chunk;
+    }
+
+    current_ = next;
+    cursor_  = impl::chunkData(next);
+    end_     = impl::chunkEnd(next);
+
+    return allocate(size, align);
+}
+
+inline ArenaScope::ArenaScope(Arena &arena) noexcept :
+    arena_{ arena },
+    marker_{ arena.mark() } {}
+
+inline ArenaScope::~ArenaScope() noexcept { arena_.rewind(marker_); }
+
+template<typename T>
+ArenaAllocator<T>::ArenaAllocator(Arena &arena) noexcept : arena_{ &arena } {}
+
+template<typename T>
+template<typename U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U> &other) noexcept :
+    arena_{ &other.arena() } {}
+
+template<typename T>
+T *ArenaAllocator<T>::allocate(usize count) noexcept {
+    Result<T *> ptr = arena_->template allocate<T>(count);
+    if (ptr.bad()) std::abort();
+
+    return ptr.val();
+}
+
+template<typename T>
+void ArenaAllocator<T>::deallocate([[maybe_unused]] T *ptr,
+                                   [[maybe_unused]] usize count) noexcept {}
+
+template<typename T>
+Arena &ArenaAllocator<T>::arena() const noexcept {
+    return *arena_;
+}
+
+template<typename T>
+template<typename U>
+bool ArenaAllocator<T>::operator==(
+    const ArenaAllocator<U> &rhs) const noexcept {
+    return arena_ == &rhs.arena();
+}
+
+} // namespace alloc
+} // namespace srr
+
+#endif // SRR_ALLOC_ARENA_HPP
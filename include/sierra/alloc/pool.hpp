@@ -0,0 +1,415 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_ALLOC_POOL_HPP
+#define SRR_ALLOC_POOL_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace alloc {
+
+struct PoolConfig {
+    usize block_size;
+    usize block_align;
+    usize slab_blocks;
+    usize batch_blocks;
+    bool  poison;
+};
+
+class Pool;
+class PoolCache;
+
+namespace impl {
+
+// Free blocks double as list nodes. next links blocks of a batch, batch links
+// batch heads while they sit in the depot and size is the batch length.
+struct PoolNode {
+    PoolNode *next;
+    PoolNode *batch;
+    usize     size;
+};
+
+struct PoolSlab {
+    PoolSlab *next;
+    usize     bytes;
+};
+
+constexpr usize POOL_DEFAULT_SLAB  = 1024;
+constexpr usize POOL_DEFAULT_BATCH = 64;
+constexpr u8    POOL_POISON_ALLOC  = 0xCD;
+constexpr u8    POOL_POISON_FREE   = 0xDD;
+
+// Depot heads pack a pointer with an ABA tag in the unused upper bits of a
+// user space address (48 bit on both x86-64 and AArch64).
+constexpr u32   POOL_PTR_BITS      = 48;
+constexpr u64   POOL_PTR_MASK      = (1ULL << POOL_PTR_BITS) - 1;
+
+[[nodiscard]] static u64       poolPack(PoolNode *node, u64 tag) noexcept;
+[[nodiscard]] static PoolNode *poolNode(u64 head) noexcept;
+[[nodiscard]] static u64       poolTag(u64 head) noexcept;
+
+} // namespace impl
+
+[[nodiscard]] constexpr PoolConfig makePoolConfig(usize size,
+                                                  usize align) noexcept;
+
+template<typename T>
+[[nodiscard]] constexpr PoolConfig makePoolConfig() noexcept;
+
+// Fixed-size block pool shared by all threads. Blocks move between threads in
+// batches through a lock-free depot, day-to-day allocation goes through a
+// PoolCache owned by each thread. Pool is safe to share between threads,
+// slabs are returned to the system only when the pool is destroyed.
+class Pool {
+public:
+    [[nodiscard]] explicit Pool(PoolConfig config) noexcept;
+
+    Pool(const Pool &pool)            = delete;
+    Pool(Pool &&pool)                 = delete;
+    Pool &operator=(const Pool &pool) = delete;
+    Pool &operator=(Pool &&pool)      = delete;
+
+    ~Pool() noexcept;
+
+    [[nodiscard]] const PoolConfig &config() const noexcept;
+    [[nodiscard]] usize             reserved() const noexcept;
+
+private:
+    friend class PoolCache;
+
+    [[nodiscard]] Result<impl::PoolNode *> acquireBatch() noexcept;
+    void releaseBatch(impl::PoolNode *batch) noexcept;
+
+    [[nodiscard]] impl::PoolNode *popBatch() noexcept;
+    void                          pushBatch(impl::PoolNode *batch) noexcept;
+
+    [[nodiscard]] Result<impl::PoolNode *> carveSlab() noexcept;
+
+    PoolConfig                             config_;
+    std::atomic<u64>                       depot_;
+    std::atomic<impl::PoolSlab *>          slabs_;
+    std::atomic<usize>                     reserved_;
+};
+
+// Per-thread front end of a Pool, allocation and free touch only the local
+// free list except when a whole batch moves to or from the depot. A cache
+// must only be used by the thread that owns it, it returns its blocks to the
+// depot on destruction.
+class PoolCache {
+public:
+    [[nodiscard]] explicit PoolCache(Pool &pool) noexcept;
+
+    PoolCache(const PoolCache &cache)            = delete;
+    PoolCache(PoolCache &&cache)                 = delete;
+    PoolCache &operator=(const PoolCache &cache) = delete;
+    PoolCache &operator=(PoolCache &&cache)      = delete;
+
+    ~PoolCache() noexcept;
+
+    [[nodiscard]] Result<void *> allocate() noexcept;
+    void                         deallocate(void *ptr) noexcept;
+
+    template<typename T, typename... Args>
+        requires std::is_nothrow_constructible_v<T, Args...>
+    [[nodiscard]] Result<T *> create(Args &&...args) noexcept;
+
+    template<typename T>
+    void destroy(T *ptr) noexcept;
+
+    void flush() noexcept;
+
+private:
+    [[nodiscard]] impl::PoolNode *detach(usize count) noexcept;
+
+    Pool           &pool_;
+    impl::PoolNode *free_;
+    usize           count_;
+};
+
+namespace impl {
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+static u64 poolPack(PoolNode *node, u64 tag) noexcept {
+    return (tag << POOL_PTR_BITS) | reinterpret_cast<std::uintptr_t>(node);
+}
+
+static PoolNode *poolNode(u64 head) noexcept {
+    return reinterpret_cast<PoolNode *>(
+        static_cast<std::uintptr_t>(head & POOL_PTR_MASK));
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+static u64 poolTag(u64 head) noexcept { return head >> POOL_PTR_BITS; }
+
+} // namespace impl
+
+constexpr PoolConfig makePoolConfig(usize size, usize align) noexcept {
+    const usize block_align = std::max(align, alignof(impl::PoolNode));
+    const usize block_size  = std::max(size, sizeof(impl::PoolNode));
+
+    return {
+        .block_size   = (block_size + block_align - 1) & ~(block_align - 1),
+        .block_align  = block_align,
+        .slab_blocks  = impl::POOL_DEFAULT_SLAB,
+        .batch_blocks = impl::POOL_DEFAULT_BATCH,
+        .poison       = false,
+    };
+}
+
+template<typename T>
+constexpr PoolConfig makePoolConfig() noexcept {
+    return makePoolConfig(sizeof(T), alignof(T));
+}
+
+inline Pool::Pool(PoolConfig config) noexcept :
+    config_{ makePoolConfig(config.block_size, config.block_align) },
+    depot_{ 0 },
+    slabs_{ nullptr },
+    reserved_{ 0 } {
+    config_.batch_blocks = std::max<usize>(config.batch_blocks, 1);
+    config_.slab_blocks  = std::max(config.slab_blocks, config_.batch_blocks);
+    config_.slab_blocks -= config_.slab_blocks % config_.batch_blocks;
+    config_.poison       = config.poison;
+}
+
+inline Pool::~Pool() noexcept {
+    impl::PoolSlab *slab = slabs_.load(std::memory_order_relaxed);
+    while (slab != nullptr) {
+        impl::PoolSlab *next = slab->next;
+        std::destroy_at(slab);
+        ::operator delete(slab, std::align_val_t{ config_.block_align });
+        slab = next;
+    }
+}
+
+inline const PoolConfig &Pool::config() const noexcept { return config_; }
+
+inline usize             Pool::reserved() const noexcept {
+    return reserved_.load(std::memory_order_relaxed);
+}
+
+inline Result<impl::PoolNode *> Pool::acquireBatch() noexcept {
+    impl::PoolNode *batch = popBatch();
+    if (batch != nullptr) return batch;
+
+    return carveSlab();
+}
+
+inline void Pool::releaseBatch(impl::PoolNode *batch) noexcept {
+    pushBatch(batch);
+}
+
+inline impl::PoolNode *Pool::popBatch() noexcept {
+    // Acquire pairs with the release in pushBatch() so the batch links are
+    // visible before they are followed.
+    u64 head = depot_.load(std::memory_order_acquire);
+
+    while (true) {
+        impl::PoolNode *batch = impl::poolNode(head);
+        if (batch == nullptr) return nullptr;
+
+        // Slabs outlive the pool's users, so a stale batch can be read
+        // safely, the tag makes the exchange below reject it.
+        const u64 next = impl::poolPack(batch->batch, impl::poolTag(head) + 1);
+
+        if (depot_.compare_exchange_weak(head,
+                                         next,
+                                         std::memory_order_acquire,
+                                         std::memory_order_acquire))
+            return batch;
+    }
+}
+
+inline void Pool::pushBatch(impl::PoolNode *batch) noexcept {
+    u64 head = depot_.load(std::memory_order_relaxed);
+
+    while (true) {
+        batch->batch   = impl::poolNode(head);
+        const u64 next = impl::poolPack(batch, impl::poolTag(head) + 1);
+
+        // Release publishes the batch links to popBatch().
+        if (depot_.compare_exchange_weak(head,
+                                         next,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed))
+            return;
+    }
+}
+
+inline Result<impl::PoolNode *> Pool::carveSlab() noexcept {
+    const usize header = std::max(sizeof(impl::PoolSlab), config_.block_align);
+    const usize blocks = config_.slab_blocks;
+    const usize bytes  = header + (blocks * config_.block_size);
+
+    void       *raw    = ::operator new(bytes,
+                                 std::align_val_t{ config_.block_align },
+                                 std::nothrow);
+    if (raw == nullptr) return Err::OUT_OF_MEMORY;
+
+    impl::PoolSlab *slab = std::construct_at(
+        static_cast<impl::PoolSlab *>(raw),
+        impl::PoolSlab{ .next = nullptr, .bytes = bytes });
+
+    // Only the destructor walks the slab list, after every user is gone.
+    slab->next           = slabs_.load(std::memory_order_relaxed);
+    while (!slabs_.compare_exchange_weak(slab->next,
+                                         slab,
+                                         std::memory_order_relaxed,
+                                         std::memory_order_relaxed)) {}
+
+    reserved_.fetch_add(bytes, std::memory_order_relaxed);
+
+    std::byte      *base  = static_cast<std::byte *>(raw) + header;
+    impl::PoolNode *first = nullptr;
+
+    for (usize start = 0; start < blocks; start += config_.batch_blocks) {
+        impl::PoolNode *next = nullptr;
+
+        for (usize i = config_.batch_blocks; i > 1; --i) {
+            std::byte *block = base + ((start + i - 1) * config_.block_size);
+            next             = std::construct_at(
+                static_cast<impl::PoolNode *>(static_cast<void *>(block)),
+                impl::PoolNode{ .next = next, .batch = nullptr, .size = 0 });
+        }
+
+        impl::PoolNode *batch = std::construct_at(
+            static_cast<impl::PoolNode *>(
+                static_cast<void *>(base + (start * config_.block_size))),
+            impl::PoolNode{ .next  = next,
+                            .batch = nullptr,
+                            .size  = config_.batch_blocks });
+
+        if (first == nullptr)
+            first = batch;
+        else
+            pushBatch(batch);
+    }
+
+    return first;
+}
+
+inline PoolCache::PoolCache(Pool &pool) noexcept :
+    pool_{ pool },
+    free_{ nullptr },
+    count_{ 0 } {}
+
+inline PoolCache::~PoolCache() noexcept { flush(); }
+
+inline Result<void *> PoolCache::allocate() noexcept {
+    if (free_ == nullptr) {
+        Result<impl::PoolNode *> batch = pool_.acquireBatch();
+        if (batch.bad()) return batch.err();
+
+        free_  = batch.val();
+        count_ = free_->size;
+    }
+
+    impl::PoolNode *node = free_;
+    free_                = node->next;
+    --count_;
+
+    if (pool_.config_.poison)
+        std::memset(node, impl::POOL_POISON_ALLOC, pool_.config_.block_size);
+
+    return static_cast<void *>(node);
+}
+
+inline void PoolCache::deallocate(void *ptr) noexcept {
+    const PoolConfig &config = pool_.config_;
+
+    if (config.poison)
+        std::memset(ptr, impl::POOL_POISON_FREE, config.block_size);
+
+    free_ = std::construct_at(
+        static_cast<impl::PoolNode *>(ptr),
+        impl::PoolNode{ .next = free_, .batch = nullptr, .size = 0 });
+    ++count_;
+
+    // Keep one batch in hand so alternating allocate and free at the
+    // boundary does not bounce batches through the depot.
+    if (count_ < 2 * config.batch_blocks) return;
+
+    pool_.releaseBatch(detach(config.batch_blocks));
+}
+
+template<typename T, typename... Args>
+    requires std::is_nothrow_constructible_v<T, Args...>
+Result<T *> PoolCache::create(Args &&...args) noexcept {
+    Result<void *> raw = allocate();
+    if (raw.bad()) return raw.err();
+
+    return std::construct_at(static_cast<T *>(raw.val()),
+                             std::forward<Args>(args)...);
+}
+
+template<typename T>
+void PoolCache::destroy(T *ptr) noexcept {
+    std::destroy_at(ptr);
+    deallocate(ptr);
+}
+
+inline void PoolCache::flush() noexcept {
+    const usize batch_blocks = pool_.config_.batch_blocks;
+
+    while (count_ != 0)
+        pool_.releaseBatch(detach(std::min(count_, batch_blocks)));
+}
+
+inline impl::PoolNode *PoolCache::detach(usize count) noexcept {
+    impl::PoolNode *batch = free_;
+    impl::PoolNode *tail  = free_;
+    for (usize i = 1; i < count; ++i) tail = tail->next;
+
+    free_        = tail->next;
+    tail->next   = nullptr;
+    batch->size  = count;
+    count_      -= count;
+
+    return batch;
+}
+
+} // namespace alloc
+} // namespace srr
+
+#endif // SRR_ALLOC_POOL_HPP
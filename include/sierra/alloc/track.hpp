@@ -0,0 +1,398 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_ALLOC_TRACK_HPP
+#define SRR_ALLOC_TRACK_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/utils/sys.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <memory>
+#include <span>
+#include <string_view>
+
+inline namespace srr {
+namespace alloc {
+
+// Tracking is opt-in. Without SRR_ALLOC_TRACKING the calls of Tracker,
+// TrackShard and TrackedAllocator do nothing, but every type keeps the same
+// layout either way, so translation units built with and without it still
+// agree on them.
+#ifdef SRR_ALLOC_TRACKING
+constexpr bool TRACK_ENABLED = true;
+#else
+constexpr bool TRACK_ENABLED = false;
+#endif
+
+constexpr usize TRACK_MAX_TAGS = 64;
+constexpr usize TRACK_SHARDS   = 16;
+
+struct TrackTag {
+    u16 id;
+};
+
+struct TrackStats {
+    i64 live_bytes;
+    i64 live_count;
+    i64 peak_bytes;
+    u64 allocs;
+};
+
+// Per-tag totals across all shards. peak_bytes sums the peaks of the
+// individual shards, so it is an upper bound of the true peak.
+struct TrackSnapshot {
+    std::array<std::string_view, TRACK_MAX_TAGS> names;
+    std::array<TrackStats, TRACK_MAX_TAGS>       stats;
+    usize                                        tags;
+};
+
+class Tracker;
+class TrackShard;
+
+namespace impl {
+
+constexpr usize TRACK_LINE       = 64;
+constexpr usize TRACK_NUMBER_MAX = 24;
+constexpr usize TRACK_NAME_WIDTH = 24;
+constexpr usize TRACK_COL_WIDTH  = 16;
+
+struct TrackCounters {
+    std::atomic<i64> live_bytes;
+    std::atomic<i64> live_count;
+    std::atomic<i64> peak_bytes;
+    std::atomic<u64> allocs;
+};
+
+struct TrackHandle {
+    TrackShard *shard;
+    TrackTag    tag;
+};
+
+static void trackFold(TrackStats          &stats,
+                      const TrackCounters &counters) noexcept;
+
+template<utils::Sink S>
+static void trackWrite(std::string_view text, usize width) noexcept;
+
+template<utils::Sink S>
+static void trackWrite(i64 value, usize width) noexcept;
+
+} // namespace impl
+
+template<utils::Sink S>
+void dumpSnapshot(const TrackSnapshot &snapshot) noexcept;
+
+// Counters of one shard of a Tracker. Updates are relaxed atomic adds, so
+// any thread may record into any shard, including freeing on one thread
+// what another allocated. Sharding only keeps threads off each other's
+// cache lines.
+class alignas(impl::TRACK_LINE) TrackShard {
+public:
+    TrackShard(const TrackShard &shard)            = delete;
+    TrackShard(TrackShard &&shard)                 = delete;
+    TrackShard &operator=(const TrackShard &shard) = delete;
+    TrackShard &operator=(TrackShard &&shard)      = delete;
+
+    ~TrackShard() noexcept                         = default;
+
+    void onAllocate(TrackTag tag, usize bytes) noexcept;
+    void onDeallocate(TrackTag tag, usize bytes) noexcept;
+
+private:
+    friend class Tracker;
+
+    [[nodiscard]] TrackShard() noexcept;
+
+    std::array<impl::TrackCounters, TRACK_MAX_TAGS> counters_;
+};
+
+// Owns the tag names and the shards. Tag names are not copied and must
+// outlive the tracker, string literals are the intended use. Shards live as
+// long as the tracker, which must outlive every allocator recording into
+// it. Tracker is safe to share between threads. Without tracking every name
+// resolves to tag 0 and snapshots are empty.
+class Tracker {
+public:
+    [[nodiscard]] explicit Tracker(
+        std::span<const std::string_view> names) noexcept;
+
+    Tracker(const Tracker &tracker)            = delete;
+    Tracker(Tracker &&tracker)                 = delete;
+    Tracker &operator=(const Tracker &tracker) = delete;
+    Tracker &operator=(Tracker &&tracker)      = delete;
+
+    ~Tracker() noexcept                        = default;
+
+    [[nodiscard]] usize            tags() const noexcept;
+    [[nodiscard]] Result<TrackTag> find(std::string_view name) const noexcept;
+
+    // Shard for the calling thread, handed out round robin. Take it once
+    // per thread and keep it.
+    [[nodiscard]] TrackShard      &shard() noexcept;
+
+    [[nodiscard]] TrackSnapshot    snapshot() const noexcept;
+
+private:
+    std::array<std::string_view, TRACK_MAX_TAGS> names_;
+    usize                                        tags_;
+
+    std::atomic<usize>                           next_;
+    std::array<TrackShard, TRACK_SHARDS>         shards_;
+};
+
+// Allocator wrapper that charges every allocation of the inner allocator to
+// a tag. Without SRR_ALLOC_TRACKING it allocates straight from the inner
+// allocator and compares equal as the inner allocator does.
+template<typename T, typename A = std::allocator<T>>
+class TrackedAllocator {
+public:
+    using value_type = T; // NOLINT(readability-identifier-naming)
+
+    template<typename U>
+    struct rebind { // NOLINT(readability-identifier-naming)
+        using other = TrackedAllocator<
+            U,
+            typename std::allocator_traits<A>::template rebind_alloc<U>>;
+    };
+
+    [[nodiscard]] TrackedAllocator(TrackShard &shard,
+                                   TrackTag    tag,
+                                   const A    &inner) noexcept;
+
+    template<typename U, typename B>
+    [[nodiscard]] TrackedAllocator(
+        const TrackedAllocator<U, B> &other) noexcept;
+
+    [[nodiscard]] T *allocate(usize count) noexcept;
+    void             deallocate(T *ptr, usize count) noexcept;
+
+    [[nodiscard]] const impl::TrackHandle &handle() const noexcept;
+    [[nodiscard]] const A                 &inner() const noexcept;
+
+    // Equal allocators also charge the same shard and tag, so memory freed
+    // through either is credited where it was charged.
+    template<typename U, typename B>
+    [[nodiscard]] bool operator==(
+        const TrackedAllocator<U, B> &rhs) const noexcept;
+
+private:
+    impl::TrackHandle       handle_;
+    [[no_unique_address]] A inner_;
+};
+
+namespace impl {
+
+static void trackFold(TrackStats          &stats,
+                      const TrackCounters &counters) noexcept {
+    stats.live_bytes += counters.live_bytes.load(std::memory_order_relaxed);
+    stats.live_count += counters.live_count.load(std::memory_order_relaxed);
+    stats.peak_bytes += counters.peak_bytes.load(std::memory_order_relaxed);
+    stats.allocs     += counters.allocs.load(std::memory_order_relaxed);
+}
+
+template<utils::Sink S>
+static void trackWrite(std::string_view text, usize width) noexcept {
+    constexpr std::string_view PAD = "                        ";
+
+    utils::Sys::write<S>(text.data(), text.size());
+    if (text.size() < width)
+        utils::Sys::write<S>(PAD.data(),
+                             std::min(width - text.size(), PAD.size()));
+}
+
+template<utils::Sink S>
+static void trackWrite(i64 value, usize width) noexcept {
+    std::array<char, TRACK_NUMBER_MAX> buf{};
+    const std::to_chars_result         res =
+        std::to_chars(buf.data(), buf.data() + buf.size(), value);
+    const usize len = static_cast<usize>(res.ptr - buf.data());
+
+    trackWrite<S>(std::string_view{ buf.data(), len }, width);
+}
+
+} // namespace impl
+
+template<utils::Sink S>
+void dumpSnapshot(const TrackSnapshot &snapshot) noexcept {
+    impl::trackWrite<S>("tag", impl::TRACK_NAME_WIDTH);
+    impl::trackWrite<S>("live bytes", impl::TRACK_COL_WIDTH);
+    impl::trackWrite<S>("live count", impl::TRACK_COL_WIDTH);
+    impl::trackWrite<S>("peak bytes", impl::TRACK_COL_WIDTH);
+    impl::trackWrite<S>("allocs\n", 0);
+
+    for (usize i = 0; i < snapshot.tags; ++i) {
+        const TrackStats &stats = snapshot.stats[i];
+
+        impl::trackWrite<S>(snapshot.names[i], impl::TRACK_NAME_WIDTH);
+        impl::trackWrite<S>(stats.live_bytes, impl::TRACK_COL_WIDTH);
+        impl::trackWrite<S>(stats.live_count, impl::TRACK_COL_WIDTH);
+        impl::trackWrite<S>(stats.peak_bytes, impl::TRACK_COL_WIDTH);
+        impl::trackWrite<S>(static_cast<i64>(stats.allocs), 0);
+        impl::trackWrite<S>("\n", 0);
+    }
+}
+
+// TrackShard ---
+
+inline TrackShard::TrackShard() noexcept : counters_{} {}
+
+inline void TrackShard::onAllocate(TrackTag tag, usize bytes) noexcept {
+    if constexpr (!TRACK_ENABLED) return;
+
+    impl::TrackCounters &counters = counters_[tag.id];
+    const i64            size     = static_cast<i64>(bytes);
+
+    const i64 live =
+        counters.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    counters.live_count.fetch_add(1, std::memory_order_relaxed);
+    counters.allocs.fetch_add(1, std::memory_order_relaxed);
+
+    i64 peak = counters.peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !counters.peak_bytes.compare_exchange_weak(
+               peak, live, std::memory_order_relaxed,
+               std::memory_order_relaxed)) {}
+}
+
+inline void TrackShard::onDeallocate(TrackTag tag, usize bytes) noexcept {
+    if constexpr (!TRACK_ENABLED) return;
+
+    impl::TrackCounters &counters = counters_[tag.id];
+
+    counters.live_bytes.fetch_sub(static_cast<i64>(bytes),
+                                  std::memory_order_relaxed);
+    counters.live_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// Tracker ---
+
+inline Tracker::Tracker(std::span<const std::string_view> names) noexcept :
+    names_{},
+    tags_{ std::min(names.size(), TRACK_MAX_TAGS) },
+    next_{ 0 },
+    shards_{} {
+    std::copy_n(names.begin(), tags_, names_.begin());
+}
+
+inline usize Tracker::tags() const noexcept {
+    return TRACK_ENABLED ? tags_ : 0;
+}
+
+inline Result<TrackTag> Tracker::find(std::string_view name) const noexcept {
+    if constexpr (!TRACK_ENABLED) return TrackTag{ 0 };
+
+    for (usize i = 0; i < tags_; ++i)
+        if (names_[i] == name) return TrackTag{ static_cast<u16>(i) };
+
+    return Err::NO_SUCH_KEY;
+}
+
+inline TrackShard &Tracker::shard() noexcept {
+    if constexpr (!TRACK_ENABLED) return shards_[0];
+
+    return shards_[next_.fetch_add(1, std::memory_order_relaxed) %
+                   TRACK_SHARDS];
+}
+
+inline TrackSnapshot Tracker::snapshot() const noexcept {
+    if constexpr (!TRACK_ENABLED)
+        return { .names = {}, .stats = {}, .tags = 0 };
+
+    TrackSnapshot snapshot{ .names = names_, .stats = {}, .tags = tags_ };
+
+    for (usize i = 0; i < tags_; ++i)
+        for (const TrackShard &shard : shards_)
+            impl::trackFold(snapshot.stats[i], shard.counters_[i]);
+
+    return snapshot;
+}
+
+// TrackedAllocator ---
+
+template<typename T, typename A>
+TrackedAllocator<T, A>::TrackedAllocator(TrackShard &shard,
+                                         TrackTag    tag,
+                                         const A    &inner) noexcept :
+    handle_{ .shard = &shard, .tag = tag },
+    inner_{ inner } {}
+
+template<typename T, typename A>
+template<typename U, typename B>
+TrackedAllocator<T, A>::TrackedAllocator(
+    const TrackedAllocator<U, B> &other) noexcept :
+    handle_{ other.handle() },
+    inner_{ other.inner() } {}
+
+template<typename T, typename A>
+T *TrackedAllocator<T, A>::allocate(usize count) noexcept {
+    if constexpr (TRACK_ENABLED)
+        handle_.shard->onAllocate(handle_.tag, count * sizeof(T));
+
+    return std::allocator_traits<A>::allocate(inner_, count);
+}
+
+template<typename T, typename A>
+void TrackedAllocator<T, A>::deallocate(T *ptr, usize count) noexcept {
+    if constexpr (TRACK_ENABLED)
+        handle_.shard->onDeallocate(handle_.tag, count * sizeof(T));
+
+    std::allocator_traits<A>::deallocate(inner_, ptr, count);
+}
+
+template<typename T, typename A>
+const impl::TrackHandle &TrackedAllocator<T, A>::handle() const noexcept {
+    return handle_;
+}
+
+template<typename T, typename A>
+const A &TrackedAllocator<T, A>::inner() const noexcept {
+    return inner_;
+}
+
+template<typename T, typename A>
+template<typename U, typename B>
+bool TrackedAllocator<T, A>::operator==(
+    const TrackedAllocator<U, B> &rhs) const noexcept {
+    if (TRACK_ENABLED && (handle_.shard != rhs.handle().shard ||
+                          handle_.tag.id != rhs.handle().tag.id))
+        return false;
+
+    return inner_ == rhs.inner();
+}
+
+} // namespace alloc
+} // namespace srr
+
+#endif // SRR_ALLOC_TRACK_HPP
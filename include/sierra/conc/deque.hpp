@@ -0,0 +1,191 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONC_DEQUE_HPP
+#define SRR_CONC_DEQUE_HPP
+
+#include "sierra/conc/queue.hpp"
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <type_traits>
+
+inline namespace srr {
+namespace conc {
+
+template<typename T>
+concept DequeStorable = std::is_trivially_copyable_v<T> &&
+                        std::atomic<T>::is_always_lock_free;
+
+// Chase-Lev work-stealing deque with a fixed capacity. The owning thread
+// pushes and pops at the bottom, any thread may steal from the top.
+template<DequeStorable T>
+class WorkDeque {
+public:
+    // Capacity is rounded up to a power of two.
+    [[nodiscard]] explicit WorkDeque(usize capacity) noexcept;
+
+    WorkDeque(const WorkDeque &deque)            = delete;
+    WorkDeque(WorkDeque &&deque)                 = delete;
+    WorkDeque &operator=(const WorkDeque &deque) = delete;
+    WorkDeque &operator=(WorkDeque &&deque)      = delete;
+
+    ~WorkDeque() noexcept;
+
+    [[nodiscard]] usize     capacity() const noexcept;
+    [[nodiscard]] bool      empty() const noexcept;
+
+    // Owner only.
+    Status                  push(T value) noexcept;
+    [[nodiscard]] Result<T> pop() noexcept;
+
+    // Any thread, fails with CONTAINER_EMPTY when empty or when it lost a
+    // race for the last element.
+    [[nodiscard]] Result<T> steal() noexcept;
+
+private:
+    std::atomic<T>                        *cells_;
+    i64                                    mask_;
+
+    alignas(CACHE_LINE) std::atomic<i64>   top_;
+    alignas(CACHE_LINE) std::atomic<i64>   bottom_;
+};
+
+template<DequeStorable T>
+WorkDeque<T>::WorkDeque(usize capacity) noexcept :
+    cells_{ nullptr },
+    mask_{ static_cast<i64>(std::bit_ceil(std::max<usize>(capacity, 1))) -
+           1 },
+    top_{ 0 },
+    bottom_{ 0 } {
+    const usize count = static_cast<usize>(mask_) + 1;
+
+    cells_            = std::allocator<std::atomic<T>>{}.allocate(count);
+    for (usize i = 0; i < count; ++i) std::construct_at(cells_ + i);
+}
+
+template<DequeStorable T>
+WorkDeque<T>::~WorkDeque() noexcept {
+    const usize count = static_cast<usize>(mask_) + 1;
+
+    std::destroy_n(cells_, count);
+    std::allocator<std::atomic<T>>{}.deallocate(cells_, count);
+}
+
+template<DequeStorable T>
+usize WorkDeque<T>::capacity() const noexcept {
+    return static_cast<usize>(mask_) + 1;
+}
+
+template<DequeStorable T>
+bool WorkDeque<T>::empty() const noexcept {
+    return bottom_.load(std::memory_order_relaxed) <=
+           top_.load(std::memory_order_relaxed);
+}
+
+template<DequeStorable T>
+Status WorkDeque<T>::push(T value) noexcept {
+    const i64 bottom = bottom_.load(std::memory_order_relaxed);
+
+    // Acquire pairs with the CAS in steal() so a stolen cell is reusable.
+    const i64 top    = top_.load(std::memory_order_acquire);
+
+    if (bottom - top > mask_) return Err::CAPACITY_EXCEEDED;
+
+    cells_[bottom & mask_].store(value, std::memory_order_relaxed);
+
+    // Release publishes the cell to the acquire load in steal().
+    bottom_.store(bottom + 1, std::memory_order_release);
+    return {};
+}
+
+template<DequeStorable T>
+Result<T> WorkDeque<T>::pop() noexcept {
+    const i64 bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(bottom, std::memory_order_relaxed);
+
+    // Sequentially consistent so the bottom store and the top load below
+    // are ordered against the same pair in steal().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    i64 top = top_.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return Err::CONTAINER_EMPTY;
+    }
+
+    const T value = cells_[bottom & mask_].load(std::memory_order_relaxed);
+    if (top != bottom) return value;
+
+    // Last element, race the thieves for it.
+    const bool won = top_.compare_exchange_strong(top,
+                                                  top + 1,
+                                                  std::memory_order_seq_cst,
+                                                  std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+
+    if (!won) return Err::CONTAINER_EMPTY;
+
+    return value;
+}
+
+template<DequeStorable T>
+Result<T> WorkDeque<T>::steal() noexcept {
+    // Acquire pairs with the CAS of other thieves and pop().
+    i64 top = top_.load(std::memory_order_acquire);
+
+    // Sequentially consistent, pairs with the fence in pop().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Acquire pairs with the release store in push().
+    const i64 bottom = bottom_.load(std::memory_order_acquire);
+
+    if (top >= bottom) return Err::CONTAINER_EMPTY;
+
+    const T value = cells_[top & mask_].load(std::memory_order_relaxed);
+
+    if (!top_.compare_exchange_strong(top,
+                                      top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+        return Err::CONTAINER_EMPTY;
+
+    return value;
+}
+
+} // namespace conc
+} // namespace srr
+
+#endif // SRR_CONC_DEQUE_HPP
@@ -0,0 +1,741 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONC_JOBS_HPP
+#define SRR_CONC_JOBS_HPP
+
+#include "sierra/alloc/pool.hpp"
+#include "sierra/conc/deque.hpp"
+#include "sierra/conc/queue.hpp"
+#include "sierra/cont/smallvector.hpp"
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/target.hpp"
+#include "sierra/utils/hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(SRR_TARGET_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(SRR_TARGET_APPLE)
+    #include <mach/mach.h>
+    #include <mach/thread_policy.h>
+    #include <pthread.h>
+#endif // SRR_TARGET_LINUX
+
+inline namespace srr {
+namespace conc {
+
+enum class JobAffinity : u8 {
+    FLOATING = 0,
+    PINNED,
+};
+
+struct JobConfig {
+    usize       workers;
+    usize       deque_capacity;
+    usize       inject_capacity;
+    JobAffinity affinity;
+};
+
+class JobSystem;
+class JobContext;
+class JobCounter;
+class JobGraph;
+
+namespace impl {
+
+// A job is one pool block, the callable lives inline in the payload.
+constexpr usize JOB_BLOCK          = 128;
+constexpr usize JOB_PAYLOAD        = 96;
+constexpr usize JOB_DEFAULT_DEQUE  = 4096;
+constexpr usize JOB_DEFAULT_INJECT = 4096;
+constexpr usize JOB_SLAB_BLOCKS    = 4096;
+constexpr usize JOB_BATCH_BLOCKS   = 64;
+constexpr u32   JOB_SPIN_ROUNDS    = 64;
+constexpr usize JOB_SPLIT_FACTOR   = 8;
+constexpr usize JOB_NODE_EDGES     = 4;
+
+constexpr u32   XORSHIFT_A         = 13;
+constexpr u32   XORSHIFT_B         = 7;
+constexpr u32   XORSHIFT_C         = 17;
+
+struct JobClosure {
+    void (*invoke)(JobClosure &closure, JobContext &ctx) noexcept;
+    void (*destroy)(JobClosure &closure) noexcept;
+    alignas(std::max_align_t) std::array<std::byte, JOB_PAYLOAD> payload;
+};
+
+struct Job {
+    JobCounter *counter;
+    JobClosure  closure;
+};
+
+struct JobNode {
+    JobClosure                                closure;
+    std::atomic<usize>                        pending;
+    usize                                     predecessors;
+    cont::SmallVector<usize, JOB_NODE_EDGES> successors;
+};
+
+static_assert(sizeof(Job) <= JOB_BLOCK);
+
+} // namespace impl
+
+template<typename F>
+concept JobCallable =
+    std::invocable<std::remove_cvref_t<F> &, JobContext &> &&
+    std::is_nothrow_constructible_v<std::remove_cvref_t<F>, F> &&
+    std::is_nothrow_destructible_v<std::remove_cvref_t<F>> &&
+    sizeof(std::remove_cvref_t<F>) <= impl::JOB_PAYLOAD &&
+    alignof(std::remove_cvref_t<F>) <= alignof(std::max_align_t);
+
+template<typename F>
+concept RangeBody = std::invocable<F &, usize, usize>;
+
+namespace impl {
+
+template<JobCallable F>
+void bindClosure(JobClosure &closure, F &&fn) noexcept;
+
+template<typename F>
+[[nodiscard]] F *closureTarget(JobClosure &closure) noexcept;
+
+void pinThread(std::thread &thread, usize cpu) noexcept;
+
+} // namespace impl
+
+// One worker per hardware thread minus the caller, which helps while it
+// waits. Pinning is a hint and is ignored where the platform has none.
+[[nodiscard]] JobConfig makeJobConfig() noexcept;
+
+// Number of outstanding jobs. Every spawn adds one, every finished job takes
+// one, so a counter reaching zero means all jobs spawned on it are done.
+class JobCounter {
+public:
+    [[nodiscard]] JobCounter() noexcept;
+
+    JobCounter(const JobCounter &counter)            = delete;
+    JobCounter(JobCounter &&counter)                 = delete;
+    JobCounter &operator=(const JobCounter &counter) = delete;
+    JobCounter &operator=(JobCounter &&counter)      = delete;
+
+    ~JobCounter() noexcept                           = default;
+
+    [[nodiscard]] bool done() const noexcept;
+
+private:
+    friend class JobContext;
+
+    std::atomic<usize> pending_;
+};
+
+// Work-stealing scheduler. Each worker owns a Chase-Lev deque, spawns from a
+// worker go to its own deque and idle workers steal from the others, spawns
+// from other threads go through a shared injection queue. Workers sleep on a
+// condition variable once they run out of work for a while.
+//
+// JobSystem is safe to share between threads, all work goes through a
+// JobContext. Every counter must be waited on before the system is
+// destroyed.
+class JobSystem {
+public:
+    [[nodiscard]] explicit JobSystem(JobConfig config) noexcept;
+
+    JobSystem(const JobSystem &system)            = delete;
+    JobSystem(JobSystem &&system)                 = delete;
+    JobSystem &operator=(const JobSystem &system) = delete;
+    JobSystem &operator=(JobSystem &&system)      = delete;
+
+    ~JobSystem() noexcept;
+
+    [[nodiscard]] usize      workers() const noexcept;
+
+    // Context for a thread that is not one of the workers. It must stay on
+    // the thread that created it and must not outlive the system.
+    [[nodiscard]] JobContext context() noexcept;
+
+private:
+    friend class JobContext;
+
+    void                      work(usize index) noexcept;
+    void                      idle(JobContext &ctx) noexcept;
+    void                      wake() noexcept;
+
+    [[nodiscard]] impl::Job  *find(JobContext &ctx) noexcept;
+
+    JobConfig                 config_;
+    alloc::Pool               pool_;
+    MpmcQueue<impl::Job *>    inject_;
+    WorkDeque<impl::Job *>   *deques_;
+    std::thread              *threads_;
+
+    std::atomic<bool>         stop_;
+    std::atomic<u64>          epoch_;
+    std::atomic<usize>        sleepers_;
+    std::mutex                idle_mutex_;
+    std::condition_variable   idle_cv_;
+};
+
+// Per-thread handle on a JobSystem. Workers get theirs passed to every job
+// they run, other threads create one with JobSystem::context(). Contexts
+// are not safe to share.
+class JobContext {
+public:
+    JobContext(const JobContext &ctx)            = delete;
+    JobContext(JobContext &&ctx)                 = delete;
+    JobContext &operator=(const JobContext &ctx) = delete;
+    JobContext &operator=(JobContext &&ctx)      = delete;
+
+    ~JobContext() noexcept                       = default;
+
+    // Worker index, EXTERNAL for contexts made by JobSystem::context().
+    static constexpr usize EXTERNAL = std::numeric_limits<usize>::max();
+
+    [[nodiscard]] usize      worker() const noexcept;
+    [[nodiscard]] JobSystem &system() noexcept;
+
+    // Runs fn on some worker. When the job cannot be queued or allocated it
+    // runs inline instead.
+    template<JobCallable F>
+    void spawn(JobCounter &counter, F &&fn) noexcept;
+
+    // Runs other jobs until counter reaches zero, so waiting inside a job
+    // never blocks its worker.
+    void wait(JobCounter &counter) noexcept;
+
+    // Runs one pending job if there is one, otherwise yields the thread.
+    // Building block for waiting on conditions other than a counter.
+    void yield() noexcept;
+
+    // Calls body(begin, end) over disjoint chunks covering [first, last) and
+    // waits for all of them. Ranges are split in halves only while the local
+    // deque is empty, so splitting follows demand and stops at grain.
+    template<RangeBody F>
+    void parallelFor(usize first, usize last, usize grain, F &&body) noexcept;
+
+    // Same with a grain that gives each thread a few chunks to balance.
+    template<RangeBody F>
+    void parallelFor(usize first, usize last, F &&body) noexcept;
+
+private:
+    friend class JobSystem;
+    friend class JobGraph;
+
+    [[nodiscard]] JobContext(JobSystem               &system,
+                             WorkDeque<impl::Job *> *deque,
+                             usize                    index) noexcept;
+
+    void                 execute(impl::Job *job) noexcept;
+    [[nodiscard]] bool   hungry() const noexcept;
+    [[nodiscard]] usize  victim() noexcept;
+
+    template<RangeBody F>
+    void splitRange(JobCounter &counter,
+                    F          &body,
+                    usize       first,
+                    usize       last,
+                    usize       grain) noexcept;
+
+    JobSystem              &system_;
+    WorkDeque<impl::Job *> *deque_;
+    usize                   index_;
+    u64                     rng_;
+    alloc::PoolCache        cache_;
+};
+
+// Fixed-capacity dependency graph. Nodes run once all their predecessors
+// have finished, a graph can be run again after its counter is waited on.
+// Cycles never finish.
+class JobGraph {
+public:
+    [[nodiscard]] explicit JobGraph(usize capacity) noexcept;
+
+    JobGraph(const JobGraph &graph)            = delete;
+    JobGraph(JobGraph &&graph)                 = delete;
+    JobGraph &operator=(const JobGraph &graph) = delete;
+    JobGraph &operator=(JobGraph &&graph)      = delete;
+
+    ~JobGraph() noexcept;
+
+    [[nodiscard]] usize size() const noexcept;
+    [[nodiscard]] usize capacity() const noexcept;
+
+    // Returns the node id, CAPACITY_EXCEEDED once the graph is full.
+    template<JobCallable F>
+    [[nodiscard]] Result<usize> add(F &&fn) noexcept;
+
+    // Makes after wait for before.
+    Status                      precede(usize before, usize after) noexcept;
+
+    // Spawns the nodes without predecessors on counter, the rest follow as
+    // their predecessors finish.
+    void                        run(JobContext &ctx,
+                                    JobCounter &counter) noexcept;
+
+private:
+    void spawnNode(JobContext &ctx, JobCounter &counter, usize id) noexcept;
+    void runNode(JobContext &ctx, JobCounter &counter, usize id) noexcept;
+
+    impl::JobNode *nodes_;
+    usize          size_;
+    usize          capacity_;
+};
+
+namespace impl {
+
+template<JobCallable F>
+void bindClosure(JobClosure &closure, F &&fn) noexcept {
+    using Fn = std::remove_cvref_t<F>;
+
+    std::construct_at(static_cast<Fn *>(static_cast<void *>(
+                          closure.payload.data())),
+                      std::forward<F>(fn));
+
+    closure.invoke = [](JobClosure &self, JobContext &ctx) noexcept {
+        std::invoke(*closureTarget<Fn>(self), ctx);
+    };
+    closure.destroy = [](JobClosure &self) noexcept {
+        std::destroy_at(closureTarget<Fn>(self));
+    };
+}
+
+// The payload is raw storage, the callable is created by bindClosure().
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+template<typename F>
+F *closureTarget(JobClosure &closure) noexcept {
+    return std::launder(reinterpret_cast<F *>(closure.payload.data()));
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Best effort, a worker that cannot be pinned still runs.
+inline void pinThread(std::thread &thread, usize cpu) noexcept {
+#if defined(SRR_TARGET_LINUX)
+    cpu_set_t set{};
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    (void)pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#elif defined(SRR_TARGET_APPLE)
+    // macOS only takes affinity tags, threads sharing a tag are kept on the
+    // same L2, distinct tags are spread. Apple silicon ignores them.
+    thread_affinity_policy_data_t policy{
+        .affinity_tag = static_cast<integer_t>(cpu + 1),
+    };
+    (void)thread_policy_set(pthread_mach_thread_np(thread.native_handle()),
+                            THREAD_AFFINITY_POLICY,
+                            &policy.affinity_tag,
+                            THREAD_AFFINITY_POLICY_COUNT);
+#else
+    (void)thread;
+    (void)cpu;
+#endif // SRR_TARGET_LINUX
+}
+
+} // namespace impl
+
+inline JobConfig makeJobConfig() noexcept {
+    const usize threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+    return {
+        .workers         = threads - 1,
+        .deque_capacity  = impl::JOB_DEFAULT_DEQUE,
+        .inject_capacity = impl::JOB_DEFAULT_INJECT,
+        .affinity        = JobAffinity::FLOATING,
+    };
+}
+
+// JobCounter ---
+
+inline JobCounter::JobCounter() noexcept : pending_{ 0 } {}
+
+inline bool JobCounter::done() const noexcept {
+    // Acquire pairs with the release in JobContext::execute().
+    return pending_.load(std::memory_order_acquire) == 0;
+}
+
+// JobSystem ---
+
+inline JobSystem::JobSystem(JobConfig config) noexcept :
+    config_{ config },
+    pool_{ alloc::PoolConfig{
+        .block_size   = impl::JOB_BLOCK,
+        .block_align  = alignof(impl::Job),
+        .slab_blocks  = impl::JOB_SLAB_BLOCKS,
+        .batch_blocks = impl::JOB_BATCH_BLOCKS,
+        .poison       = false,
+    } },
+    inject_{ config.inject_capacity },
+    deques_{ nullptr },
+    threads_{ nullptr },
+    stop_{ false },
+    epoch_{ 0 },
+    sleepers_{ 0 } {
+    const usize count = config_.workers;
+
+    deques_ = std::allocator<WorkDeque<impl::Job *>>{}.allocate(count);
+    for (usize i = 0; i < count; ++i)
+        std::construct_at(deques_ + i, config_.deque_capacity);
+
+    threads_ = std::allocator<std::thread>{}.allocate(count);
+    for (usize i = 0; i < count; ++i) {
+        std::construct_at(threads_ + i, [this, i]() noexcept { work(i); });
+
+        if (config_.affinity == JobAffinity::PINNED)
+            impl::pinThread(threads_[i], i);
+    }
+}
+
+inline JobSystem::~JobSystem() noexcept {
+    {
+        const std::lock_guard<std::mutex> lock{ idle_mutex_ };
+        stop_.store(true, std::memory_order_relaxed);
+        epoch_.fetch_add(1, std::memory_order_relaxed);
+    }
+    idle_cv_.notify_all();
+
+    const usize count = config_.workers;
+    for (usize i = 0; i < count; ++i) threads_[i].join();
+
+    std::destroy_n(threads_, count);
+    std::allocator<std::thread>{}.deallocate(threads_, count);
+
+    std::destroy_n(deques_, count);
+    std::allocator<WorkDeque<impl::Job *>>{}.deallocate(deques_, count);
+}
+
+inline usize JobSystem::workers() const noexcept {
+    return config_.workers;
+}
+
+inline JobContext JobSystem::context() noexcept {
+    return JobContext{ *this, nullptr, JobContext::EXTERNAL };
+}
+
+inline void JobSystem::work(usize index) noexcept {
+    JobContext ctx{ *this, deques_ + index, index };
+    u32        spins = 0;
+
+    while (!stop_.load(std::memory_order_relaxed)) {
+        impl::Job *job = find(ctx);
+
+        if (job != nullptr) {
+            ctx.execute(job);
+            spins = 0;
+            continue;
+        }
+
+        if (++spins < impl::JOB_SPIN_ROUNDS) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        spins = 0;
+        idle(ctx);
+    }
+}
+
+inline void JobSystem::idle(JobContext &ctx) noexcept {
+    const u64 epoch = epoch_.load(std::memory_order_relaxed);
+    sleepers_.fetch_add(1, std::memory_order_relaxed);
+
+    // Pairs with the fence in wake(), either the search below sees the new
+    // job or wake() sees this sleeper.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    impl::Job *job = find(ctx);
+
+    if (job == nullptr) {
+        std::unique_lock<std::mutex> lock{ idle_mutex_ };
+        idle_cv_.wait(lock, [this, epoch]() noexcept -> bool {
+            return epoch_.load(std::memory_order_relaxed) != epoch ||
+                   stop_.load(std::memory_order_relaxed);
+        });
+    }
+
+    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    if (job != nullptr) ctx.execute(job);
+}
+
+inline void JobSystem::wake() noexcept {
+    // Pairs with the fence in idle().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_relaxed) == 0) return;
+
+    {
+        const std::lock_guard<std::mutex> lock{ idle_mutex_ };
+        epoch_.fetch_add(1, std::memory_order_relaxed);
+    }
+    idle_cv_.notify_one();
+}
+
+inline impl::Job *JobSystem::find(JobContext &ctx) noexcept {
+    if (ctx.deque_ != nullptr) {
+        Result<impl::Job *> own = ctx.deque_->pop();
+        if (own.ok()) return own.val();
+    }
+
+    Result<impl::Job *> injected = inject_.pop();
+    if (injected.ok()) return injected.val();
+
+    const usize count = config_.workers;
+    if (count == 0) return nullptr;
+
+    const usize start = ctx.victim() % count;
+    for (usize i = 0; i < count; ++i) {
+        WorkDeque<impl::Job *> *victim = deques_ + ((start + i) % count);
+        if (victim == ctx.deque_) continue;
+
+        Result<impl::Job *> stolen = victim->steal();
+        if (stolen.ok()) return stolen.val();
+    }
+
+    return nullptr;
+}
+
+// JobContext ---
+
+inline JobContext::JobContext(JobSystem               &system,
+                              WorkDeque<impl::Job *> *deque,
+                              usize                    index) noexcept :
+    system_{ system },
+    deque_{ deque },
+    index_{ index },
+    rng_{ utils::mix64(index) | 1 },
+    cache_{ system.pool_ } {}
+
+inline usize      JobContext::worker() const noexcept { return index_; }
+
+inline JobSystem &JobContext::system() noexcept { return system_; }
+
+template<JobCallable F>
+void JobContext::spawn(JobCounter &counter, F &&fn) noexcept {
+    Result<void *> raw = cache_.allocate();
+    if (raw.bad()) {
+        std::invoke(fn, *this);
+        return;
+    }
+
+    impl::Job *job = std::construct_at(static_cast<impl::Job *>(raw.val()),
+                                       impl::Job{ .counter = &counter,
+                                                  .closure = {} });
+    impl::bindClosure(job->closure, std::forward<F>(fn));
+
+    // The job can only finish after it is queued, which publishes this
+    // increment, so the counter never drops to zero early.
+    counter.pending_.fetch_add(1, std::memory_order_relaxed);
+
+    const Status queued = deque_ != nullptr ? deque_->push(job)
+                                            : system_.inject_.push(job);
+    if (queued.bad()) {
+        execute(job);
+        return;
+    }
+
+    system_.wake();
+}
+
+inline void JobContext::wait(JobCounter &counter) noexcept {
+    while (!counter.done()) yield();
+}
+
+inline void JobContext::yield() noexcept {
+    impl::Job *job = system_.find(*this);
+
+    if (job != nullptr)
+        execute(job);
+    else
+        std::this_thread::yield();
+}
+
+template<RangeBody F>
+void JobContext::parallelFor(usize first,
+                             usize last,
+                             usize grain,
+                             F   &&body) noexcept {
+    if (first >= last) return;
+
+    JobCounter counter;
+    splitRange(counter, body, first, last, std::max<usize>(grain, 1));
+    wait(counter);
+}
+
+template<RangeBody F>
+void JobContext::parallelFor(usize first, usize last, F &&body) noexcept {
+    if (first >= last) return;
+
+    const usize chunks = (system_.workers() + 1) * impl::JOB_SPLIT_FACTOR;
+    parallelFor(first, last, (last - first) / chunks, std::forward<F>(body));
+}
+
+inline void JobContext::execute(impl::Job *job) noexcept {
+    job->closure.invoke(job->closure, *this);
+    job->closure.destroy(job->closure);
+
+    JobCounter *counter = job->counter;
+    cache_.destroy(job);
+
+    // Release pairs with the acquire in JobCounter::done() so the waiter
+    // sees everything the job did.
+    counter->pending_.fetch_sub(1, std::memory_order_release);
+}
+
+inline bool JobContext::hungry() const noexcept {
+    return deque_ == nullptr || deque_->empty();
+}
+
+inline usize JobContext::victim() noexcept {
+    rng_ ^= rng_ << impl::XORSHIFT_A;
+    rng_ ^= rng_ >> impl::XORSHIFT_B;
+    rng_ ^= rng_ << impl::XORSHIFT_C;
+    return static_cast<usize>(rng_);
+}
+
+template<RangeBody F>
+void JobContext::splitRange(JobCounter &counter,
+                            F          &body,
+                            usize       first,
+                            usize       last,
+                            usize       grain) noexcept {
+    while (first < last) {
+        // Hand the upper half out only while nothing else is queued here,
+        // a busy system keeps running grain-sized chunks without splitting.
+        if (last - first > grain && hungry()) {
+            const usize mid = first + ((last - first) / 2);
+
+            spawn(counter,
+                  [&counter, &body, mid, last, grain](
+                      JobContext &ctx) noexcept {
+                      ctx.splitRange(counter, body, mid, last, grain);
+                  });
+
+            last = mid;
+            continue;
+        }
+
+        const usize end = first + std::min(grain, last - first);
+        std::invoke(body, first, end);
+        first = end;
+    }
+}
+
+// JobGraph ---
+
+inline JobGraph::JobGraph(usize capacity) noexcept :
+    nodes_{ std::allocator<impl::JobNode>{}.allocate(capacity) },
+    size_{ 0 },
+    capacity_{ capacity } {}
+
+inline JobGraph::~JobGraph() noexcept {
+    for (usize i = 0; i < size_; ++i)
+        nodes_[i].closure.destroy(nodes_[i].closure);
+
+    std::destroy_n(nodes_, size_);
+    std::allocator<impl::JobNode>{}.deallocate(nodes_, capacity_);
+}
+
+inline usize JobGraph::size() const noexcept { return size_; }
+
+inline usize JobGraph::capacity() const noexcept { return capacity_; }
+
+template<JobCallable F>
+Result<usize> JobGraph::add(F &&fn) noexcept {
+    if (size_ == capacity_) return Err::CAPACITY_EXCEEDED;
+
+    impl::JobNode *node = std::construct_at(nodes_ + size_);
+    impl::bindClosure(node->closure, std::forward<F>(fn));
+
+    return size_++;
+}
+
+inline Status JobGraph::precede(usize before, usize after) noexcept {
+    if (before >= size_ || after >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    nodes_[before].successors.push(after);
+    ++nodes_[after].predecessors;
+    return {};
+}
+
+inline void JobGraph::run(JobContext &ctx, JobCounter &counter) noexcept {
+    // Spawning publishes these to whichever worker runs the node.
+    for (usize i = 0; i < size_; ++i)
+        nodes_[i].pending.store(nodes_[i].predecessors,
+                                std::memory_order_relaxed);
+
+    for (usize i = 0; i < size_; ++i)
+        if (nodes_[i].predecessors == 0) spawnNode(ctx, counter, i);
+}
+
+inline void JobGraph::spawnNode(JobContext &ctx,
+                                JobCounter &counter,
+                                usize       id) noexcept {
+    ctx.spawn(counter, [this, &counter, id](JobContext &inner) noexcept {
+        runNode(inner, counter, id);
+    });
+}
+
+inline void JobGraph::runNode(JobContext &ctx,
+                              JobCounter &counter,
+                              usize       id) noexcept {
+    impl::JobNode &node = nodes_[id];
+    node.closure.invoke(node.closure, ctx);
+
+    // Successors are spawned before this job finishes, so counter stays
+    // above zero until the last node is done.
+    const usize count = node.successors.size();
+    for (usize i = 0; i < count; ++i) {
+        const usize next = node.successors[i];
+
+        // Release publishes this node's work, acquire on the last
+        // decrement makes every predecessor's work visible to the node.
+        if (nodes_[next].pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            spawnNode(ctx, counter, next);
+    }
+}
+
+} // namespace conc
+} // namespace srr
+
+#endif // SRR_CONC_JOBS_HPP
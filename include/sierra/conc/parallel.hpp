@@ -0,0 +1,555 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONC_PARALLEL_HPP
+#define SRR_CONC_PARALLEL_HPP
+
+#include "sierra/conc/jobs.hpp"
+#include "sierra/cont/smallvector.hpp"
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace conc {
+
+template<typename T>
+concept ParallelMovable = std::is_nothrow_move_constructible_v<T> &&
+                          std::is_nothrow_move_assignable_v<T> &&
+                          std::is_nothrow_destructible_v<T>;
+
+template<typename F, typename T>
+concept ParallelBody = std::invocable<F &, T &> &&
+                       (std::is_void_v<std::invoke_result_t<F &, T &>> ||
+                        std::is_same_v<std::invoke_result_t<F &, T &>, Status>);
+
+template<typename F, typename T>
+using TransformResult = std::invoke_result_t<F &, const T &>;
+
+namespace impl {
+
+// Below this many elements per chunk the fork and join costs more than the
+// work it spreads.
+constexpr usize PARALLEL_MIN_CHUNK = 2048;
+constexpr usize PARALLEL_INLINE    = 64;
+
+// Uninitialized scratch storage for the out-of-place passes.
+template<typename T>
+class ParallelBuffer {
+public:
+    [[nodiscard]] explicit ParallelBuffer(usize count) noexcept;
+
+    ParallelBuffer(const ParallelBuffer &buffer)            = delete;
+    ParallelBuffer(ParallelBuffer &&buffer)                 = delete;
+    ParallelBuffer &operator=(const ParallelBuffer &buffer) = delete;
+    ParallelBuffer &operator=(ParallelBuffer &&buffer)      = delete;
+
+    ~ParallelBuffer() noexcept;
+
+    [[nodiscard]] bool ok() const noexcept;
+    [[nodiscard]] T   *data() noexcept;
+
+private:
+    T *data_;
+};
+
+template<typename T, typename C>
+[[nodiscard]] usize mergeSplit(T    *left,
+                               usize left_size,
+                               T    *right,
+                               usize right_size,
+                               usize rank,
+                               C    &cmp) noexcept;
+
+} // namespace impl
+
+// Data-parallel algorithms on a JobSystem. Work is cut into a few chunks per
+// thread and run through the context, which helps while it waits.
+//
+// The first failure, either a Status returned by a body or a call to
+// cancel(), stops the chunks that have not started yet and is returned by
+// every algorithm until reset(). cancel() and cancelled() are safe to call
+// from any thread, the algorithms must run on the context's thread.
+class Parallel {
+public:
+    [[nodiscard]] explicit Parallel(JobContext &ctx) noexcept;
+
+    Parallel(const Parallel &parallel)            = delete;
+    Parallel(Parallel &&parallel)                 = delete;
+    Parallel &operator=(const Parallel &parallel) = delete;
+    Parallel &operator=(Parallel &&parallel)      = delete;
+
+    ~Parallel() noexcept                          = default;
+
+    [[nodiscard]] Status status() const noexcept;
+    [[nodiscard]] bool   cancelled() const noexcept;
+
+    void                 cancel() noexcept;
+    void                 reset() noexcept;
+
+    // Calls body on every element. A body may return Status to stop the
+    // remaining chunks on failure.
+    template<typename T, ParallelBody<T> F>
+    Status forEach(std::span<T> data, F &&body) noexcept;
+
+    // Reduces transform(x) for every x in data, chunks are combined left to
+    // right so reduce must be associative but need not be commutative.
+    template<typename T, cont::VectorStorable R, typename Reduce, typename F>
+        requires std::invocable<F &, const T &> &&
+                 std::invocable<Reduce &, R, TransformResult<F, T>>
+    [[nodiscard]] Result<R>
+    transformReduce(std::span<const T> data,
+                    R                  init,
+                    Reduce           &&reduce,
+                    F                &&transform) noexcept;
+
+    // out[i] = in[0] op ... op in[i], in and out may be the same range.
+    template<cont::VectorStorable T, typename Op>
+        requires std::invocable<Op &, const T &, const T &>
+    Status inclusiveScan(std::span<const T> in,
+                         std::span<T>       out,
+                         Op               &&op) noexcept;
+
+    // Stable merge sort. Chunks are sorted in place, then merged pairwise
+    // with every merge split between threads. Falls back to std::stable_sort
+    // when the scratch buffer cannot be allocated. A cancelled sort leaves a
+    // permutation of the input.
+    template<ParallelMovable T, std::strict_weak_order<const T &, const T &> C>
+    Status sort(std::span<T> data, C &&cmp) noexcept;
+
+    // Stable partition, returns the number of elements that satisfy pred.
+    template<ParallelMovable T, std::predicate<T &> P>
+    [[nodiscard]] Result<usize> partition(std::span<T> data,
+                                          P          &&pred) noexcept;
+
+private:
+    [[nodiscard]] usize chunkCount(usize count) const noexcept;
+
+    void                fail(Err err) noexcept;
+
+    // Runs fn(chunk, first, last) for each of chunks equal slices of count,
+    // fn checks for cancellation itself where skipping a chunk is safe.
+    template<typename F>
+    void forChunks(usize count, usize chunks, F &&fn) noexcept;
+
+    JobContext      &ctx_;
+    std::atomic<Err> status_;
+};
+
+namespace impl {
+
+template<typename T>
+ParallelBuffer<T>::ParallelBuffer(usize count) noexcept :
+    data_{ static_cast<T *>(::operator new(count * sizeof(T),
+                                           std::align_val_t{ alignof(T) },
+                                           std::nothrow)) } {}
+
+template<typename T>
+ParallelBuffer<T>::~ParallelBuffer() noexcept {
+    ::operator delete(data_, std::align_val_t{ alignof(T) });
+}
+
+template<typename T>
+bool ParallelBuffer<T>::ok() const noexcept {
+    return data_ != nullptr;
+}
+
+template<typename T>
+T *ParallelBuffer<T>::data() noexcept {
+    return data_;
+}
+
+// Merge path, returns how many of the first rank outputs of a stable merge
+// come from left.
+template<typename T, typename C>
+usize mergeSplit(T    *left,
+                 usize left_size,
+                 T    *right,
+                 usize right_size,
+                 usize rank,
+                 C    &cmp) noexcept {
+    usize low  = rank > right_size ? rank - right_size : 0;
+    usize high = std::min(rank, left_size);
+
+    while (low < high) {
+        const usize mid = low + ((high - low) / 2);
+
+        if (std::invoke(cmp, right[rank - mid - 1], left[mid]))
+            high = mid;
+        else
+            low = mid + 1;
+    }
+
+    return low;
+}
+
+} // namespace impl
+
+inline Parallel::Parallel(JobContext &ctx) noexcept :
+    ctx_{ ctx },
+    status_{ Err::OK } {}
+
+inline Status Parallel::status() const noexcept {
+    // Acquire pairs with the release in fail() so the failing chunk's
+    // writes are visible along with its error.
+    return status_.load(std::memory_order_acquire);
+}
+
+inline bool Parallel::cancelled() const noexcept {
+    return status_.load(std::memory_order_relaxed) != Err::OK;
+}
+
+inline void Parallel::cancel() noexcept { fail(Err::CANCELLED); }
+
+inline void Parallel::reset() noexcept {
+    status_.store(Err::OK, std::memory_order_relaxed);
+}
+
+inline usize Parallel::chunkCount(usize count) const noexcept {
+    const usize threads = ctx_.system().workers() + 1;
+
+    return std::clamp<usize>(count / impl::PARALLEL_MIN_CHUNK,
+                             1,
+                             threads * impl::JOB_SPLIT_FACTOR);
+}
+
+inline void Parallel::fail(Err err) noexcept {
+    Err expected = Err::OK;
+
+    // Release pairs with the acquire in status(), only the first error
+    // is kept.
+    (void)status_.compare_exchange_strong(expected,
+                                          err,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed);
+}
+
+template<typename F>
+void Parallel::forChunks(usize count, usize chunks, F &&fn) noexcept {
+    ctx_.parallelFor(0, chunks, 1, [&](usize first, usize last) noexcept {
+        for (usize chunk = first; chunk < last; ++chunk)
+            std::invoke(fn,
+                        chunk,
+                        count * chunk / chunks,
+                        count * (chunk + 1) / chunks);
+    });
+}
+
+template<typename T, ParallelBody<T> F>
+Status Parallel::forEach(std::span<T> data, F &&body) noexcept {
+    if (cancelled()) return status();
+
+    forChunks(data.size(),
+              chunkCount(data.size()),
+              [&](usize, usize first, usize last) noexcept {
+                  if (cancelled()) return;
+
+                  for (usize i = first; i < last; ++i) {
+                      if constexpr (std::is_void_v<
+                                        std::invoke_result_t<F &, T &>>) {
+                          std::invoke(body, data[i]);
+                      } else {
+                          const Status result = std::invoke(body, data[i]);
+                          if (result.ok()) continue;
+
+                          fail(result.err());
+                          return;
+                      }
+                  }
+              });
+
+    return status();
+}
+
+template<typename T, cont::VectorStorable R, typename Reduce, typename F>
+    requires std::invocable<F &, const T &> &&
+             std::invocable<Reduce &, R, TransformResult<F, T>>
+Result<R> Parallel::transformReduce(std::span<const T> data,
+                                    R                  init,
+                                    Reduce           &&reduce,
+                                    F                &&transform) noexcept {
+    if (cancelled()) return status().err();
+    if (data.empty()) return init;
+
+    const usize chunks = chunkCount(data.size());
+
+    cont::SmallVector<R, impl::PARALLEL_INLINE> partials;
+    partials.reserve(chunks);
+    for (usize i = 0; i < chunks; ++i) partials.push(R{ init });
+
+    forChunks(data.size(),
+              chunks,
+              [&](usize chunk, usize first, usize last) noexcept {
+                  if (cancelled()) return;
+
+                  R acc = std::invoke(transform, data[first]);
+                  for (usize i = first + 1; i < last; ++i)
+                      acc = std::invoke(reduce,
+                                        std::move(acc),
+                                        std::invoke(transform, data[i]));
+
+                  partials[chunk] = std::move(acc);
+              });
+
+    if (cancelled()) return status().err();
+
+    for (usize i = 0; i < chunks; ++i)
+        init = std::invoke(reduce, std::move(init), std::move(partials[i]));
+
+    return init;
+}
+
+template<cont::VectorStorable T, typename Op>
+    requires std::invocable<Op &, const T &, const T &>
+Status Parallel::inclusiveScan(std::span<const T> in,
+                               std::span<T>       out,
+                               Op               &&op) noexcept {
+    if (cancelled()) return status();
+    if (out.size() < in.size()) return Err::CAPACITY_EXCEEDED;
+    if (in.empty()) return {};
+
+    const usize chunks = chunkCount(in.size());
+
+    // Pass one reduces every chunk but the last, pass two scans each chunk
+    // starting from the total of the chunks before it.
+    cont::SmallVector<T, impl::PARALLEL_INLINE> carry;
+    carry.reserve(chunks);
+    for (usize i = 0; i < chunks; ++i) carry.push(T{ in[0] });
+
+    forChunks(in.size(),
+              chunks,
+              [&](usize chunk, usize first, usize last) noexcept {
+                  if (chunk + 1 == chunks || cancelled()) return;
+
+                  T acc = in[first];
+                  for (usize i = first + 1; i < last; ++i)
+                      acc = std::invoke(op, acc, in[i]);
+
+                  carry[chunk + 1] = std::move(acc);
+              });
+
+    if (cancelled()) return status();
+
+    for (usize i = 2; i < chunks; ++i)
+        carry[i] = std::invoke(op, carry[i - 1], carry[i]);
+
+    forChunks(in.size(),
+              chunks,
+              [&](usize chunk, usize first, usize last) noexcept {
+                  if (cancelled()) return;
+
+                  T acc = chunk == 0 ? in[first]
+                                     : std::invoke(op, carry[chunk], in[first]);
+                  out[first] = acc;
+
+                  for (usize i = first + 1; i < last; ++i) {
+                      acc    = std::invoke(op, acc, in[i]);
+                      out[i] = acc;
+                  }
+              });
+
+    return status();
+}
+
+template<ParallelMovable T, std::strict_weak_order<const T &, const T &> C>
+Status Parallel::sort(std::span<T> data, C &&cmp) noexcept {
+    if (cancelled()) return status();
+
+    const usize count  = data.size();
+    const usize chunks = std::bit_floor(chunkCount(count));
+
+    if (chunks < 2) {
+        std::stable_sort(data.begin(), data.end(), cmp);
+        return status();
+    }
+
+    impl::ParallelBuffer<T> buffer{ count };
+    if (!buffer.ok()) {
+        std::stable_sort(data.begin(), data.end(), cmp);
+        return status();
+    }
+
+    T *base    = data.data();
+    T *scratch = buffer.data();
+
+    // Chunks move into scratch after sorting, so every element lives in
+    // exactly one of the two arrays at each round boundary.
+    ctx_.parallelFor(0, chunks, 1, [&](usize first, usize last) noexcept {
+        for (usize chunk = first; chunk < last; ++chunk) {
+            T *begin = base + (count * chunk / chunks);
+            T *end   = base + (count * (chunk + 1) / chunks);
+
+            std::stable_sort(begin, end, cmp);
+            std::uninitialized_move(begin, end, scratch + (begin - base));
+        }
+    });
+
+    T *src = scratch;
+    T *dst = base;
+
+    for (usize width = 1; width < chunks && !cancelled(); width *= 2) {
+        const usize pieces = 2 * width;
+
+        ctx_.parallelFor(0, chunks, 1, [&](usize first, usize last) noexcept {
+            for (usize task = first; task < last; ++task) {
+                const usize pair  = task / pieces * pieces;
+                const usize piece = task % pieces;
+
+                const usize low   = count * pair / chunks;
+                const usize mid   = count * (pair + width) / chunks;
+                const usize high  = count * (pair + pieces) / chunks;
+
+                const usize begin = (high - low) * piece / pieces;
+                const usize end   = (high - low) * (piece + 1) / pieces;
+
+                const usize left_begin = impl::mergeSplit(src + low,
+                                                          mid - low,
+                                                          src + mid,
+                                                          high - mid,
+                                                          begin,
+                                                          cmp);
+                const usize left_end   = impl::mergeSplit(src + low,
+                                                        mid - low,
+                                                        src + mid,
+                                                        high - mid,
+                                                        end,
+                                                        cmp);
+
+                std::merge(std::make_move_iterator(src + low + left_begin),
+                           std::make_move_iterator(src + low + left_end),
+                           std::make_move_iterator(src + mid + begin -
+                                                   left_begin),
+                           std::make_move_iterator(src + mid + end - left_end),
+                           dst + low + begin,
+                           cmp);
+            }
+        });
+
+        std::swap(src, dst);
+    }
+
+    if (src != base) {
+        ctx_.parallelFor(0, chunks, 1, [&](usize first, usize last) noexcept {
+            std::move(src + (count * first / chunks),
+                      src + (count * last / chunks),
+                      base + (count * first / chunks));
+        });
+    }
+
+    std::destroy_n(scratch, count);
+    return status();
+}
+
+template<ParallelMovable T, std::predicate<T &> P>
+Result<usize> Parallel::partition(std::span<T> data, P &&pred) noexcept {
+    if (cancelled()) return status().err();
+
+    const usize count  = data.size();
+    const usize chunks = chunkCount(count);
+
+    impl::ParallelBuffer<T> buffer{ count };
+    impl::ParallelBuffer<u8> flags{ count };
+    if (!buffer.ok() || !flags.ok()) return Err::OUT_OF_MEMORY;
+
+    // Pass one evaluates pred once per element and counts the matches of
+    // each chunk, pass two scatters into scratch at the chunk offsets.
+    cont::SmallVector<usize, impl::PARALLEL_INLINE> matches;
+    matches.reserve(chunks);
+    for (usize i = 0; i < chunks; ++i) matches.push(0);
+
+    forChunks(count,
+              chunks,
+              [&](usize chunk, usize first, usize last) noexcept {
+                  if (cancelled()) return;
+
+                  usize matched = 0;
+                  for (usize i = first; i < last; ++i) {
+                      const bool keep     = std::invoke(pred, data[i]);
+                      flags.data()[i]     = static_cast<u8>(keep);
+                      matched            += static_cast<usize>(keep);
+                  }
+                  matches[chunk] = matched;
+              });
+
+    if (cancelled()) return status().err();
+
+    // Matches become the offset of each chunk's first match.
+    usize total = 0;
+    for (usize i = 0; i < chunks; ++i) {
+        const usize matched  = matches[i];
+        matches[i]           = total;
+        total               += matched;
+    }
+
+    T *scratch = buffer.data();
+
+    // Scatter and move back ignore cancellation, every element has to make
+    // it back into data.
+    forChunks(count,
+              chunks,
+              [&](usize chunk, usize first, usize last) noexcept {
+                  usize kept = matches[chunk];
+                  usize rest = total + first - kept;
+
+                  for (usize i = first; i < last; ++i) {
+                      const usize slot = flags.data()[i] != 0 ? kept++
+                                                              : rest++;
+                      std::construct_at(scratch + slot, std::move(data[i]));
+                  }
+              });
+
+    ctx_.parallelFor(0, chunks, 1, [&](usize first, usize last) noexcept {
+        T *begin = scratch + (count * first / chunks);
+        T *end   = scratch + (count * last / chunks);
+
+        std::move(begin, end, data.data() + (begin - scratch));
+        std::destroy(begin, end);
+    });
+
+    return total;
+}
+
+} // namespace conc
+} // namespace srr
+
+#endif // SRR_CONC_PARALLEL_HPP
@@ -0,0 +1,504 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONC_QUEUE_HPP
+#define SRR_CONC_QUEUE_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/memory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+inline namespace srr {
+namespace conc {
+
+template<typename T>
+concept QueueStorable = utils::SafeDestructible<T> &&
+                        utils::SafeMovePolicy<T> && utils::SafeCopyPolicy<T>;
+
+// Fixed instead of std::hardware_destructive_interference_size, which is
+// not stable across compiler flags and would change the type layout.
+constexpr usize CACHE_LINE = 64;
+
+namespace impl {
+
+template<QueueStorable T>
+class QueueSlot {
+public:
+    [[nodiscard]] T *get() noexcept;
+
+private:
+    alignas(T) std::array<std::byte, sizeof(T)> bytes_;
+};
+
+template<QueueStorable T>
+struct MpmcCell {
+    std::atomic<usize> seq;
+    QueueSlot<T>       slot;
+};
+
+} // namespace impl
+
+// Bounded single-producer single-consumer ring. Exactly one thread may push
+// and exactly one thread may pop, each side keeps a cached copy of the other
+// side's index so the shared line is only read when the cache runs out.
+template<QueueStorable T>
+class SpscQueue {
+public:
+    // Capacity is rounded up to a power of two.
+    [[nodiscard]] explicit SpscQueue(usize capacity) noexcept;
+
+    SpscQueue(const SpscQueue &queue)            = delete;
+    SpscQueue(SpscQueue &&queue)                 = delete;
+    SpscQueue &operator=(const SpscQueue &queue) = delete;
+    SpscQueue &operator=(SpscQueue &&queue)      = delete;
+
+    ~SpscQueue() noexcept;
+
+    [[nodiscard]] usize capacity() const noexcept;
+
+    Status              push(T &&value) noexcept;
+    Status              push(const T &value) noexcept
+        requires utils::SafeCopyable<T>;
+
+    [[nodiscard]] Result<T> pop() noexcept;
+
+    // Moves as many values as fit and returns how many were taken.
+    usize                   pushBulk(std::span<T> values) noexcept;
+
+    // Hands up to max values to sink in order and returns how many.
+    template<typename F>
+    usize popBulk(usize max, F &&sink) noexcept;
+
+private:
+    impl::QueueSlot<T>                    *slots_;
+    usize                                  mask_;
+
+    alignas(CACHE_LINE) std::atomic<usize> tail_;
+    usize                                  head_cache_;
+
+    alignas(CACHE_LINE) std::atomic<usize> head_;
+    usize                                  tail_cache_;
+};
+
+// Bounded multi-producer multi-consumer queue (Vyukov). Every cell carries a
+// sequence number that tells producers and consumers whose turn it is, so a
+// push or pop costs one CAS on the shared position. Bulk operations claim a
+// run of ready cells with a single CAS.
+template<QueueStorable T>
+class MpmcQueue {
+public:
+    // Capacity is rounded up to a power of two.
+    [[nodiscard]] explicit MpmcQueue(usize capacity) noexcept;
+
+    MpmcQueue(const MpmcQueue &queue)            = delete;
+    MpmcQueue(MpmcQueue &&queue)                 = delete;
+    MpmcQueue &operator=(const MpmcQueue &queue) = delete;
+    MpmcQueue &operator=(MpmcQueue &&queue)      = delete;
+
+    ~MpmcQueue() noexcept;
+
+    [[nodiscard]] usize capacity() const noexcept;
+
+    Status              push(T &&value) noexcept;
+    Status              push(const T &value) noexcept
+        requires utils::SafeCopyable<T>;
+
+    [[nodiscard]] Result<T> pop() noexcept;
+
+    usize                   pushBulk(std::span<T> values) noexcept;
+
+    template<typename F>
+    usize popBulk(usize max, F &&sink) noexcept;
+
+private:
+    // Claim a run of up to max ready cells with one CAS, returning its
+    // length and first position.
+    [[nodiscard]] usize claimPush(usize max, usize &first) noexcept;
+    [[nodiscard]] usize claimPop(usize max, usize &first) noexcept;
+
+    impl::MpmcCell<T>                     *cells_;
+    usize                                  mask_;
+
+    alignas(CACHE_LINE) std::atomic<usize> enqueue_;
+    alignas(CACHE_LINE) std::atomic<usize> dequeue_;
+};
+
+namespace impl {
+
+// Slots are raw storage, values are created with construct_at before use.
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+template<QueueStorable T>
+T *QueueSlot<T>::get() noexcept {
+    return std::launder(reinterpret_cast<T *>(bytes_.data()));
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+} // namespace impl
+
+// SpscQueue ---
+
+template<QueueStorable T>
+SpscQueue<T>::SpscQueue(usize capacity) noexcept :
+    slots_{ nullptr },
+    mask_{ std::bit_ceil(std::max<usize>(capacity, 1)) - 1 },
+    tail_{ 0 },
+    head_cache_{ 0 },
+    head_{ 0 },
+    tail_cache_{ 0 } {
+    slots_ = std::allocator<impl::QueueSlot<T>>{}.allocate(mask_ + 1);
+}
+
+template<QueueStorable T>
+SpscQueue<T>::~SpscQueue() noexcept {
+    const usize tail = tail_.load(std::memory_order_relaxed);
+    for (usize pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos)
+        std::destroy_at(slots_[pos & mask_].get());
+
+    std::allocator<impl::QueueSlot<T>>{}.deallocate(slots_, mask_ + 1);
+}
+
+template<QueueStorable T>
+usize SpscQueue<T>::capacity() const noexcept {
+    return mask_ + 1;
+}
+
+template<QueueStorable T>
+Status SpscQueue<T>::push(T &&value) noexcept {
+    const usize tail = tail_.load(std::memory_order_relaxed);
+
+    if (tail - head_cache_ > mask_) {
+        // Acquire pairs with the release in pop() so the slot is free.
+        head_cache_ = head_.load(std::memory_order_acquire);
+        if (tail - head_cache_ > mask_) return Err::CAPACITY_EXCEEDED;
+    }
+
+    std::construct_at(slots_[tail & mask_].get(), std::move(value));
+
+    // Release publishes the constructed value to pop().
+    tail_.store(tail + 1, std::memory_order_release);
+    return {};
+}
+
+template<QueueStorable T>
+Status SpscQueue<T>::push(const T &value) noexcept
+    requires utils::SafeCopyable<T>
+{
+    T copy{ value };
+    return push(std::move(copy));
+}
+
+template<QueueStorable T>
+Result<T> SpscQueue<T>::pop() noexcept {
+    const usize head = head_.load(std::memory_order_relaxed);
+
+    if (head == tail_cache_) {
+        // Acquire pairs with the release in push() so the value is visible.
+        tail_cache_ = tail_.load(std::memory_order_acquire);
+        if (head == tail_cache_) return Err::CONTAINER_EMPTY;
+    }
+
+    T        *slot = slots_[head & mask_].get();
+    Result<T> value{ std::move(*slot) };
+    std::destroy_at(slot);
+
+    // Release hands the emptied slot back to push().
+    head_.store(head + 1, std::memory_order_release);
+    return value;
+}
+
+template<QueueStorable T>
+usize SpscQueue<T>::pushBulk(std::span<T> values) noexcept {
+    const usize tail = tail_.load(std::memory_order_relaxed);
+
+    if (tail + values.size() - head_cache_ > mask_ + 1) {
+        // Acquire pairs with the release in pop() and popBulk().
+        head_cache_ = head_.load(std::memory_order_acquire);
+    }
+
+    const usize count =
+        std::min(values.size(), mask_ + 1 - (tail - head_cache_));
+
+    for (usize i = 0; i < count; ++i)
+        std::construct_at(slots_[(tail + i) & mask_].get(),
+                          std::move(values[i]));
+
+    // Release publishes the whole run to the consumer at once.
+    tail_.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+template<QueueStorable T>
+template<typename F>
+// NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+usize SpscQueue<T>::popBulk(usize max, F &&sink) noexcept {
+    const usize head = head_.load(std::memory_order_relaxed);
+
+    if (tail_cache_ - head < max) {
+        // Acquire pairs with the release in push() and pushBulk().
+        tail_cache_ = tail_.load(std::memory_order_acquire);
+    }
+
+    const usize count = std::min(max, tail_cache_ - head);
+
+    for (usize i = 0; i < count; ++i) {
+        T *slot = slots_[(head + i) & mask_].get();
+        sink(std::move(*slot));
+        std::destroy_at(slot);
+    }
+
+    // Release hands the emptied run back to the producer.
+    head_.store(head + count, std::memory_order_release);
+    return count;
+}
+
+// MpmcQueue ---
+
+template<QueueStorable T>
+MpmcQueue<T>::MpmcQueue(usize capacity) noexcept :
+    cells_{ nullptr },
+    mask_{ std::bit_ceil(std::max<usize>(capacity, 1)) - 1 },
+    enqueue_{ 0 },
+    dequeue_{ 0 } {
+    cells_ = std::allocator<impl::MpmcCell<T>>{}.allocate(mask_ + 1);
+
+    for (usize i = 0; i <= mask_; ++i) {
+        std::construct_at(cells_ + i);
+        cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+}
+
+template<QueueStorable T>
+MpmcQueue<T>::~MpmcQueue() noexcept {
+    const usize tail = enqueue_.load(std::memory_order_relaxed);
+    for (usize pos = dequeue_.load(std::memory_order_relaxed); pos != tail;
+         ++pos)
+        std::destroy_at(cells_[pos & mask_].slot.get());
+
+    std::destroy_n(cells_, mask_ + 1);
+
+    std::allocator<impl::MpmcCell<T>>{}.deallocate(cells_, mask_ + 1);
+}
+
+template<QueueStorable T>
+usize MpmcQueue<T>::capacity() const noexcept {
+    return mask_ + 1;
+}
+
+template<QueueStorable T>
+Status MpmcQueue<T>::push(T &&value) noexcept {
+    usize pos = enqueue_.load(std::memory_order_relaxed);
+
+    while (true) {
+        impl::MpmcCell<T> &cell = cells_[pos & mask_];
+
+        // Acquire pairs with the release in pop() that freed the cell.
+        const usize        seq  = cell.seq.load(std::memory_order_acquire);
+
+        if (seq == pos) {
+            if (enqueue_.compare_exchange_weak(pos,
+                                               pos + 1,
+                                               std::memory_order_relaxed,
+                                               std::memory_order_relaxed)) {
+                std::construct_at(cell.slot.get(), std::move(value));
+
+                // Release publishes the value to pop().
+                cell.seq.store(pos + 1, std::memory_order_release);
+                return {};
+            }
+        } else if (seq < pos) {
+            return Err::CAPACITY_EXCEEDED;
+        } else {
+            pos = enqueue_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<QueueStorable T>
+Status MpmcQueue<T>::push(const T &value) noexcept
+    requires utils::SafeCopyable<T>
+{
+    T copy{ value };
+    return push(std::move(copy));
+}
+
+template<QueueStorable T>
+Result<T> MpmcQueue<T>::pop() noexcept {
+    usize pos = dequeue_.load(std::memory_order_relaxed);
+
+    while (true) {
+        impl::MpmcCell<T> &cell = cells_[pos & mask_];
+
+        // Acquire pairs with the release in push() that filled the cell.
+        const usize        seq  = cell.seq.load(std::memory_order_acquire);
+
+        if (seq == pos + 1) {
+            if (dequeue_.compare_exchange_weak(pos,
+                                               pos + 1,
+                                               std::memory_order_relaxed,
+                                               std::memory_order_relaxed)) {
+                T        *slot = cell.slot.get();
+                Result<T> value{ std::move(*slot) };
+                std::destroy_at(slot);
+
+                // Release hands the cell to the producer one lap ahead.
+                cell.seq.store(pos + mask_ + 1, std::memory_order_release);
+                return value;
+            }
+        } else if (seq < pos + 1) {
+            return Err::CONTAINER_EMPTY;
+        } else {
+            pos = dequeue_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<QueueStorable T>
+usize MpmcQueue<T>::pushBulk(std::span<T> values) noexcept {
+    usize       first = 0;
+    const usize count = claimPush(values.size(), first);
+
+    for (usize i = 0; i < count; ++i) {
+        const usize        pos  = first + i;
+        impl::MpmcCell<T> &cell = cells_[pos & mask_];
+
+        std::construct_at(cell.slot.get(), std::move(values[i]));
+
+        // Release publishes each value to pop() and popBulk().
+        cell.seq.store(pos + 1, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template<QueueStorable T>
+template<typename F>
+// NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+usize MpmcQueue<T>::popBulk(usize max, F &&sink) noexcept {
+    usize       first = 0;
+    const usize count = claimPop(max, first);
+
+    for (usize i = 0; i < count; ++i) {
+        const usize        pos  = first + i;
+        impl::MpmcCell<T> &cell = cells_[pos & mask_];
+        T                 *slot = cell.slot.get();
+
+        sink(std::move(*slot));
+        std::destroy_at(slot);
+
+        // Release hands each cell to the producer one lap ahead.
+        cell.seq.store(pos + mask_ + 1, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template<QueueStorable T>
+usize MpmcQueue<T>::claimPush(usize max, usize &first) noexcept {
+    if (max == 0) return 0;
+
+    usize pos = enqueue_.load(std::memory_order_relaxed);
+
+    while (true) {
+        // Acquire pairs with the release in pop() and popBulk() that freed
+        // each cell of the run.
+        usize count = 0;
+        while (count < max && cells_[(pos + count) & mask_].seq.load(
+                                  std::memory_order_acquire) == pos + count)
+            ++count;
+
+        if (count == 0) {
+            const usize seq =
+                cells_[pos & mask_].seq.load(std::memory_order_relaxed);
+            if (seq < pos) return 0;
+
+            pos = enqueue_.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (enqueue_.compare_exchange_weak(pos,
+                                           pos + count,
+                                           std::memory_order_relaxed,
+                                           std::memory_order_relaxed)) {
+            first = pos;
+            return count;
+        }
+    }
+}
+
+template<QueueStorable T>
+usize MpmcQueue<T>::claimPop(usize max, usize &first) noexcept {
+    if (max == 0) return 0;
+
+    usize pos = dequeue_.load(std::memory_order_relaxed);
+
+    while (true) {
+        // Acquire pairs with the release in push() and pushBulk() that
+        // filled each cell of the run.
+        usize count = 0;
+        while (count < max && cells_[(pos + count) & mask_].seq.load(
+                                  std::memory_order_acquire) == pos + count + 1)
+            ++count;
+
+        if (count == 0) {
+            const usize seq =
+                cells_[pos & mask_].seq.load(std::memory_order_relaxed);
+            if (seq < pos + 1) return 0;
+
+            pos = dequeue_.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (dequeue_.compare_exchange_weak(pos,
+                                           pos + count,
+                                           std::memory_order_relaxed,
+                                           std::memory_order_relaxed)) {
+            first = pos;
+            return count;
+        }
+    }
+}
+
+} // namespace conc
+} // namespace srr
+
+#endif // SRR_CONC_QUEUE_HPP
@@ -0,0 +1,342 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONC_TASK_HPP
+#define SRR_CONC_TASK_HPP
+
+#include "sierra/alloc/arena.hpp"
+#include "sierra/conc/jobs.hpp"
+#include "sierra/error.hpp"
+#include "sierra/fsys/file.hpp"
+#include "sierra/fsys/path.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace conc {
+
+template<ResultStorable T>
+class Task;
+
+template<ResultStorable T>
+class TaskSlot;
+
+namespace impl {
+
+template<typename T>
+struct TaskFrame {
+    Result<T> (*run)(TaskFrame &frame, JobContext &ctx) noexcept;
+    void (*destroy)(TaskFrame &frame) noexcept;
+};
+
+template<typename T, typename F>
+struct TaskBody : TaskFrame<T> {
+    F fn;
+};
+
+template<typename T>
+struct TaskLaunch {
+    Task<T>     task;
+    TaskSlot<T> *slot;
+
+    void         operator()(JobContext &ctx) noexcept;
+};
+
+struct TaskProbe {
+    void operator()(JobContext &ctx) noexcept;
+};
+
+} // namespace impl
+
+template<typename F>
+using TaskValue = typename std::invoke_result_t<F &, JobContext &>::ValueType;
+
+template<typename F, typename T>
+using TaskNext =
+    typename std::invoke_result_t<F &, JobContext &, T &&>::ValueType;
+
+template<typename F>
+concept TaskCallable =
+    std::invocable<std::remove_cvref_t<F> &, JobContext &> &&
+    std::is_nothrow_constructible_v<std::remove_cvref_t<F>, F> &&
+    std::is_nothrow_destructible_v<std::remove_cvref_t<F>>;
+
+// Anything that can run a job on a counter and wait for it, JobContext is
+// the one every task ends up on.
+template<typename E>
+concept TaskExecutor = requires(E                &executor,
+                                JobCounter       &counter,
+                                impl::TaskProbe &&probe) {
+    executor.spawn(counter, std::move(probe));
+    executor.wait(counter);
+};
+
+// Lazy unit of work that produces a Result<T>. Nothing runs until the task
+// is run or launched, then() chains a step that only runs on success so
+// errors flow through without manual plumbing.
+//
+// Frames live in an Arena chosen by the caller, one allocation per task or
+// step and none while running, so the arena must outlive the task and, like
+// any arena, belongs to one thread. A frame that cannot be allocated makes
+// the task fail with OUT_OF_MEMORY when run.
+template<ResultStorable T>
+class Task {
+public:
+    using ValueType = T;
+
+    [[nodiscard]] explicit Task(Err fault) noexcept;
+    [[nodiscard]] Task(Task &&task) noexcept;
+
+    Task(const Task &task)            = delete;
+    Task &operator=(const Task &task) = delete;
+    Task &operator=(Task &&task)      = delete;
+
+    ~Task() noexcept;
+
+    [[nodiscard]] bool      valid() const noexcept;
+
+    // Runs the task and every step on this thread, consuming it.
+    [[nodiscard]] Result<T> run(JobContext &ctx) && noexcept;
+
+    // next(ctx, value) runs with the value of this task once it succeeds.
+    template<typename F>
+        requires std::invocable<std::remove_cvref_t<F> &, JobContext &, T &&>
+    [[nodiscard]] Task<TaskNext<F, T>> then(alloc::Arena &arena,
+                                            F           &&next) && noexcept;
+
+private:
+    template<TaskCallable F>
+    friend Task<TaskValue<F>> makeTask(alloc::Arena &arena, F &&fn) noexcept;
+
+    [[nodiscard]] explicit Task(impl::TaskFrame<T> *frame) noexcept;
+
+    impl::TaskFrame<T> *frame_;
+    Err                 fault_;
+};
+
+// Result of a launched task. get() waits through the executor, so a job
+// that waits on a slot keeps its worker busy with other jobs.
+template<ResultStorable T>
+class TaskSlot {
+public:
+    [[nodiscard]] TaskSlot() noexcept;
+
+    TaskSlot(const TaskSlot &slot)            = delete;
+    TaskSlot(TaskSlot &&slot)                 = delete;
+    TaskSlot &operator=(const TaskSlot &slot) = delete;
+    TaskSlot &operator=(TaskSlot &&slot)      = delete;
+
+    ~TaskSlot() noexcept                      = default;
+
+    [[nodiscard]] bool ready() const noexcept;
+
+    // Takes the result, fails with CONTAINER_EMPTY when nothing was
+    // launched on the slot or the result was already taken.
+    template<TaskExecutor E>
+    [[nodiscard]] Result<T> get(E &executor) noexcept;
+
+private:
+    friend struct impl::TaskLaunch<T>;
+
+    template<TaskExecutor E, ResultStorable U>
+    friend void launch(E &executor, Task<U> &&task, TaskSlot<U> &slot) noexcept;
+
+    JobCounter               counter_;
+    std::optional<Result<T>> result_;
+};
+
+template<TaskCallable F>
+[[nodiscard]] Task<TaskValue<F>> makeTask(alloc::Arena &arena,
+                                          F           &&fn) noexcept;
+
+// Runs task as a job, its result lands in slot.
+template<TaskExecutor E, ResultStorable T>
+void launch(E &executor, Task<T> &&task, TaskSlot<T> &slot) noexcept;
+
+// Reads from the start of the file at path into buffer, the value is the
+// number of bytes read.
+[[nodiscard]] Task<usize> readTask(alloc::Arena   &arena,
+                                   fsys::Path      path,
+                                   std::span<char> buffer) noexcept;
+
+// Task ---
+
+template<ResultStorable T>
+Task<T>::Task(Err fault) noexcept : frame_{ nullptr }, fault_{ fault } {}
+
+template<ResultStorable T>
+Task<T>::Task(impl::TaskFrame<T> *frame) noexcept :
+    frame_{ frame },
+    fault_{ Err::OK } {}
+
+template<ResultStorable T>
+Task<T>::Task(Task &&task) noexcept :
+    frame_{ std::exchange(task.frame_, nullptr) },
+    fault_{ task.fault_ } {}
+
+template<ResultStorable T>
+Task<T>::~Task() noexcept {
+    if (frame_ != nullptr) frame_->destroy(*frame_);
+}
+
+template<ResultStorable T>
+bool Task<T>::valid() const noexcept {
+    return frame_ != nullptr;
+}
+
+template<ResultStorable T>
+Result<T> Task<T>::run(JobContext &ctx) && noexcept {
+    // A consumed task has neither a frame nor a fault.
+    if (frame_ == nullptr)
+        return fault_ != Err::OK ? fault_ : Err::CONTAINER_EMPTY;
+
+    impl::TaskFrame<T> *frame = std::exchange(frame_, nullptr);
+
+    Result<T>           result = frame->run(*frame, ctx);
+    frame->destroy(*frame);
+
+    return result;
+}
+
+template<ResultStorable T>
+template<typename F>
+    requires std::invocable<std::remove_cvref_t<F> &, JobContext &, T &&>
+Task<TaskNext<F, T>> Task<T>::then(alloc::Arena &arena, F &&next) && noexcept {
+    using U = TaskNext<F, T>;
+
+    if (frame_ == nullptr) return Task<U>{ fault_ };
+
+    return makeTask(
+        arena,
+        [prev = std::move(*this), step = std::forward<F>(next)](
+            JobContext &ctx) mutable noexcept -> Result<U> {
+            Result<T> value = std::move(prev).run(ctx);
+            if (value.bad()) return value.err();
+
+            return std::invoke(step, ctx, std::move(value).val());
+        });
+}
+
+// TaskSlot ---
+
+template<ResultStorable T>
+TaskSlot<T>::TaskSlot() noexcept : counter_{}, result_{} {}
+
+template<ResultStorable T>
+bool TaskSlot<T>::ready() const noexcept {
+    return counter_.done() && result_.has_value();
+}
+
+template<ResultStorable T>
+template<TaskExecutor E>
+Result<T> TaskSlot<T>::get(E &executor) noexcept {
+    executor.wait(counter_);
+    if (!result_.has_value()) return Err::CONTAINER_EMPTY;
+
+    Result<T> result{ std::move(*result_) };
+    result_.reset();
+
+    return result;
+}
+
+namespace impl {
+
+template<typename T>
+void TaskLaunch<T>::operator()(JobContext &ctx) noexcept {
+    slot->result_.emplace(std::move(task).run(ctx));
+}
+
+inline void TaskProbe::operator()(JobContext & /*ctx*/) noexcept {}
+
+} // namespace impl
+
+template<TaskCallable F>
+Task<TaskValue<F>> makeTask(alloc::Arena &arena, F &&fn) noexcept {
+    using T    = TaskValue<F>;
+    using Body = impl::TaskBody<T, std::remove_cvref_t<F>>;
+
+    Result<void *> raw = arena.allocate(sizeof(Body), alignof(Body));
+    if (raw.bad()) return Task<T>{ raw.err() };
+
+    Body *body = std::construct_at(
+        static_cast<Body *>(raw.val()),
+        Body{
+            {
+                .run = [](impl::TaskFrame<T> &frame,
+                          JobContext         &ctx) noexcept -> Result<T> {
+                    return std::invoke(static_cast<Body &>(frame).fn, ctx);
+                },
+                .destroy = [](impl::TaskFrame<T> &frame) noexcept {
+                    std::destroy_at(&static_cast<Body &>(frame));
+                },
+            },
+            std::forward<F>(fn),
+        });
+
+    return Task<T>{ static_cast<impl::TaskFrame<T> *>(body) };
+}
+
+template<TaskExecutor E, ResultStorable T>
+void launch(E &executor, Task<T> &&task, TaskSlot<T> &slot) noexcept {
+    slot.result_.reset();
+    executor.spawn(slot.counter_,
+                   impl::TaskLaunch<T>{
+                       .task = std::move(task),
+                       .slot = &slot,
+                   });
+}
+
+inline Task<usize> readTask(alloc::Arena   &arena,
+                            fsys::Path      path,
+                            std::span<char> buffer) noexcept {
+    return makeTask(arena,
+                    [path = std::move(path),
+                     buffer](JobContext &) noexcept -> Result<usize> {
+                        Result<fsys::File> file = fsys::openFile(path);
+                        if (file.bad()) return file.err();
+
+                        Result<fsys::FileRead> read = file.val().read();
+                        if (read.bad()) return read.err();
+
+                        return read.val().read(buffer);
+                    });
+}
+
+} // namespace conc
+} // namespace srr
+
+#endif // SRR_CONC_TASK_HPP
@@ -0,0 +1,776 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONT_FLATMAP_HPP
+#define SRR_CONT_FLATMAP_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/hash.hpp"
+#include "sierra/utils/memory.hpp"
+#include "sierra/utils/simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace cont {
+
+template<typename T>
+concept FlatStorable = utils::SafeDestructible<T> && utils::SafeMovePolicy<T>;
+
+template<typename K>
+struct FlatHash;
+
+template<typename H, typename Q>
+concept FlatHasher = requires(const Q &query) {
+    { H::hash(query) } noexcept -> std::same_as<u64>;
+};
+
+template<typename K, typename H, typename Q>
+concept FlatLookup =
+    FlatHasher<H, Q> && requires(const K &key, const Q &query) {
+        { key == query } -> std::convertible_to<bool>;
+    };
+
+template<FlatStorable K, FlatStorable V>
+struct FlatEntry {
+    K key;
+    V value;
+};
+
+template<typename S>
+class FlatIterator;
+
+namespace impl {
+
+// Control bytes: full slots store the low 7 bits of their hash, free slots
+// have the high bit set so a single movemask finds them.
+constexpr u8    FLAT_EMPTY    = 0x80;
+constexpr u8    FLAT_DELETED  = 0xFE;
+constexpr u8    FLAT_H2_MASK  = 0x7F;
+constexpr u32   FLAT_H2_BITS  = 7;
+constexpr usize FLAT_GROUP    = utils::SIMD_WIDTH;
+constexpr usize FLAT_LOAD_NUM = 7;
+constexpr usize FLAT_LOAD_DEN = 8;
+constexpr usize FLAT_NPOS     = USIZE_MAX;
+
+[[nodiscard]] constexpr usize flatMaxLoad(usize capacity) noexcept;
+[[nodiscard]] constexpr usize flatCapacityFor(usize count) noexcept;
+
+template<typename S, typename K, typename H>
+class FlatTable {
+public:
+    [[nodiscard]] FlatTable() noexcept;
+    [[nodiscard]] FlatTable(FlatTable &&table) noexcept;
+
+    FlatTable(const FlatTable &table)            = delete;
+    FlatTable &operator=(const FlatTable &table) = delete;
+    FlatTable &operator=(FlatTable &&table)      = delete;
+
+    ~FlatTable() noexcept;
+
+    [[nodiscard]] usize size() const noexcept;
+    [[nodiscard]] usize capacity() const noexcept;
+
+    template<typename Q>
+    [[nodiscard]] usize find(const Q &query, u64 hash) const noexcept;
+
+    // Claims a free slot for a key known to be absent, the caller must
+    // construct the slot before any other call.
+    [[nodiscard]] usize prepare(u64 hash) noexcept;
+
+    [[nodiscard]] S       &slot(usize idx) noexcept;
+    [[nodiscard]] const S &slot(usize idx) const noexcept;
+
+    void                   erase(usize idx) noexcept;
+    void                   reserve(usize count) noexcept;
+    void                   rehash(usize count) noexcept;
+    void                   clear() noexcept;
+
+    [[nodiscard]] FlatIterator<S>       begin() noexcept;
+    [[nodiscard]] FlatIterator<S>       end() noexcept;
+    [[nodiscard]] FlatIterator<const S> begin() const noexcept;
+    [[nodiscard]] FlatIterator<const S> end() const noexcept;
+
+private:
+    [[nodiscard]] static const K &keyOf(const S &slot) noexcept;
+    [[nodiscard]] static u8       h2Of(u64 hash) noexcept;
+    [[nodiscard]] static usize    h1Of(u64 hash) noexcept;
+
+    [[nodiscard]] usize           findFree(u64 hash) const noexcept;
+    void                          resize(usize capacity) noexcept;
+    void                          release() noexcept;
+
+    u8                           *ctrl_;
+    S                            *slots_;
+    usize                         capacity_;
+    usize                         size_;
+    usize                         growth_left_;
+};
+
+} // namespace impl
+
+template<typename S>
+class FlatIterator {
+public:
+    [[nodiscard]] FlatIterator(S        *slots,
+                               const u8 *ctrl,
+                               usize     idx,
+                               usize     capacity) noexcept;
+
+    [[nodiscard]] S            &operator*() const noexcept;
+    [[nodiscard]] S            *operator->() const noexcept;
+
+    FlatIterator               &operator++() noexcept;
+
+    [[nodiscard]] bool operator==(const FlatIterator &rhs) const noexcept;
+
+private:
+    void      skip() noexcept;
+
+    S        *slots_;
+    const u8 *ctrl_;
+    usize     idx_;
+    usize     capacity_;
+};
+
+// Open addressing hash map with SIMD probing over 16 control bytes at a
+// time. Entries are stored inline, references are invalidated by rehashing.
+template<FlatStorable K, FlatStorable V, typename H = FlatHash<K>>
+class FlatMap {
+public:
+    using Entry = FlatEntry<K, V>;
+
+    [[nodiscard]] FlatMap() noexcept = default;
+    [[nodiscard]] FlatMap(FlatMap &&map) noexcept;
+
+    FlatMap(const FlatMap &map)            = delete;
+    FlatMap &operator=(const FlatMap &map) = delete;
+    FlatMap &operator=(FlatMap &&map)      = delete;
+
+    ~FlatMap() noexcept                    = default;
+
+    [[nodiscard]] usize size() const noexcept;
+    [[nodiscard]] usize capacity() const noexcept;
+    [[nodiscard]] bool  empty() const noexcept;
+
+    void                reserve(usize count) noexcept;
+    void                rehash(usize count) noexcept;
+    void                clear() noexcept;
+
+    template<typename Q>
+        requires FlatLookup<K, H, Q>
+    [[nodiscard]] bool contains(const Q &key) const noexcept;
+
+    template<typename Q>
+        requires FlatLookup<K, H, Q>
+    [[nodiscard]] Result<V &> find(const Q &key) noexcept;
+
+    template<typename Q>
+        requires FlatLookup<K, H, Q>
+    [[nodiscard]] Result<const V &> find(const Q &key) const noexcept;
+
+    Result<V &> insert(K &&key, V &&value) noexcept;
+    V          &insertOrAssign(K &&key, V &&value) noexcept;
+
+    template<typename Q>
+        requires FlatLookup<K, H, Q>
+    Status erase(const Q &key) noexcept;
+
+    [[nodiscard]] FlatIterator<Entry>       begin() noexcept;
+    [[nodiscard]] FlatIterator<Entry>       end() noexcept;
+    [[nodiscard]] FlatIterator<const Entry> begin() const noexcept;
+    [[nodiscard]] FlatIterator<const Entry> end() const noexcept;
+
+private:
+    impl::FlatTable<Entry, K, H> table_;
+};
+
+template<FlatStorable K, typename H = FlatHash<K>>
+class FlatSet {
+public:
+    [[nodiscard]] FlatSet() noexcept = default;
+    [[nodiscard]] FlatSet(FlatSet &&set) noexcept;
+
+    FlatSet(const FlatSet &set)            = delete;
+    FlatSet &operator=(const FlatSet &set) = delete;
+    FlatSet &operator=(FlatSet &&set)      = delete;
+
+    ~FlatSet() noexcept                    = default;
+
+    [[nodiscard]] usize size() const noexcept;
+    [[nodiscard]] usize capacity() const noexcept;
+    [[nodiscard]] bool  empty() const noexcept;
+
+    void                reserve(usize count) noexcept;
+    void                rehash(usize count) noexcept;
+    void                clear() noexcept;
+
+    template<typename Q>
+        requires FlatLookup<K, H, Q>
+    [[nodiscard]] bool contains(const Q &key) const noexcept;
+
+    Status             insert(K &&key) noexcept;
+
+    template<typename Q>
+        requires FlatLookup<K, H, Q>
+    Status erase(const Q &key) noexcept;
+
+    [[nodiscard]] FlatIterator<const K> begin() const noexcept;
+    [[nodiscard]] FlatIterator<const K> end() const noexcept;
+
+private:
+    impl::FlatTable<K, K, H> table_;
+};
+
+template<typename K>
+    requires std::integral<K> || std::is_enum_v<K>
+struct FlatHash<K> {
+    [[nodiscard]] static constexpr u64 hash(K key) noexcept;
+};
+
+template<>
+struct FlatHash<std::string> {
+    [[nodiscard]] static constexpr u64 hash(std::string_view key) noexcept;
+};
+
+template<>
+struct FlatHash<std::string_view> {
+    [[nodiscard]] static constexpr u64 hash(std::string_view key) noexcept;
+};
+
+// IMPL ---
+
+template<typename K>
+    requires std::integral<K> || std::is_enum_v<K>
+constexpr u64 FlatHash<K>::hash(K key) noexcept {
+    return utils::mix64(static_cast<u64>(key));
+}
+
+constexpr u64 FlatHash<std::string>::hash(std::string_view key) noexcept {
+    return utils::hash64(key);
+}
+
+constexpr u64 FlatHash<std::string_view>::hash(std::string_view key) noexcept {
+    return utils::hash64(key);
+}
+
+namespace impl {
+
+constexpr usize flatMaxLoad(usize capacity) noexcept {
+    return capacity / FLAT_LOAD_DEN * FLAT_LOAD_NUM;
+}
+
+constexpr usize flatCapacityFor(usize count) noexcept {
+    if (count == 0) return 0;
+
+    const usize wanted = (count * FLAT_LOAD_DEN / FLAT_LOAD_NUM) + 1;
+    return std::bit_ceil(std::max(wanted, FLAT_GROUP));
+}
+
+template<typename S, typename K, typename H>
+FlatTable<S, K, H>::FlatTable() noexcept :
+    ctrl_{ nullptr },
+    slots_{ nullptr },
+    capacity_{ 0 },
+    size_{ 0 },
+    growth_left_{ 0 } {}
+
+template<typename S, typename K, typename H>
+FlatTable<S, K, H>::FlatTable(FlatTable &&table) noexcept :
+    ctrl_{ std::exchange(table.ctrl_, nullptr) },
+    slots_{ std::exchange(table.slots_, nullptr) },
+    capacity_{ std::exchange(table.capacity_, 0) },
+    size_{ std::exchange(table.size_, 0) },
+    growth_left_{ std::exchange(table.growth_left_, 0) } {}
+
+template<typename S, typename K, typename H>
+FlatTable<S, K, H>::~FlatTable() noexcept {
+    release();
+}
+
+template<typename S, typename K, typename H>
+usize FlatTable<S, K, H>::size() const noexcept {
+    return size_;
+}
+
+template<typename S, typename K, typename H>
+usize FlatTable<S, K, H>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<typename S, typename K, typename H>
+template<typename Q>
+usize FlatTable<S, K, H>::find(const Q &query, u64 hash) const noexcept {
+    if (capacity_ == 0) return FLAT_NPOS;
+
+    const utils::U8x16 tag   = utils::U8x16::splat(h2Of(hash));
+    const utils::U8x16 empty = utils::U8x16::splat(FLAT_EMPTY);
+    const usize        mask  = (capacity_ / FLAT_GROUP) - 1;
+
+    usize              group = h1Of(hash) & mask;
+    for (usize step = 1;; ++step) {
+        const usize        base = group * FLAT_GROUP;
+        const utils::U8x16 ctrl = utils::U8x16::load(ctrl_ + base);
+
+        for (u32 hits = ctrl.eq(tag).mask(); hits != 0; hits &= hits - 1) {
+            const usize idx = base + static_cast<usize>(std::countr_zero(hits));
+            if (keyOf(slots_[idx]) == query) return idx;
+        }
+
+        if (ctrl.eq(empty).mask() != 0) return FLAT_NPOS;
+
+        group = (group + step) & mask;
+    }
+}
+
+template<typename S, typename K, typename H>
+usize FlatTable<S, K, H>::prepare(u64 hash) noexcept {
+    usize idx = capacity_ == 0 ? FLAT_NPOS : findFree(hash);
+
+    if (idx == FLAT_NPOS || (growth_left_ == 0 && ctrl_[idx] == FLAT_EMPTY)) {
+        // Reclaim tombstones in place when they make up most of the load.
+        if (capacity_ != 0 && size_ * 2 < flatMaxLoad(capacity_))
+            resize(capacity_);
+        else
+            resize(flatCapacityFor(size_ + 1));
+
+        idx = findFree(hash);
+    }
+
+    if (ctrl_[idx] == FLAT_EMPTY) --growth_left_;
+
+    ctrl_[idx] = h2Of(hash);
+    ++size_;
+
+    return idx;
+}
+
+template<typename S, typename K, typename H>
+S &FlatTable<S, K, H>::slot(usize idx) noexcept {
+    return slots_[idx];
+}
+
+template<typename S, typename K, typename H>
+const S &FlatTable<S, K, H>::slot(usize idx) const noexcept {
+    return slots_[idx];
+}
+
+template<typename S, typename K, typename H>
+void FlatTable<S, K, H>::erase(usize idx) noexcept {
+    std::destroy_at(&slots_[idx]);
+    --size_;
+
+    // A group that still holds an empty slot was never full, so no probe
+    // sequence continues past it and the slot can be freed outright.
+    const usize        base  = idx - (idx % FLAT_GROUP);
+    const utils::U8x16 ctrl  = utils::U8x16::load(ctrl_ + base);
+    const utils::U8x16 empty = utils::U8x16::splat(FLAT_EMPTY);
+
+    if (ctrl.eq(empty).mask() != 0) {
+        ctrl_[idx] = FLAT_EMPTY;
+        ++growth_left_;
+    } else {
+        ctrl_[idx] = FLAT_DELETED;
+    }
+}
+
+template<typename S, typename K, typename H>
+void FlatTable<S, K, H>::reserve(usize count) noexcept {
+    if (count <= size_ + growth_left_) return;
+
+    resize(flatCapacityFor(count));
+}
+
+template<typename S, typename K, typename H>
+void FlatTable<S, K, H>::rehash(usize count) noexcept {
+    resize(flatCapacityFor(std::max(count, size_)));
+}
+
+template<typename S, typename K, typename H>
+void FlatTable<S, K, H>::clear() noexcept {
+    for (usize i = 0; i < capacity_; ++i)
+        if (ctrl_[i] < FLAT_EMPTY) std::destroy_at(&slots_[i]);
+
+    if (capacity_ != 0) std::memset(ctrl_, FLAT_EMPTY, capacity_);
+
+    size_        = 0;
+    growth_left_ = flatMaxLoad(capacity_);
+}
+
+template<typename S, typename K, typename H>
+FlatIterator<S> FlatTable<S, K, H>::begin() noexcept {
+    return { slots_, ctrl_, 0, capacity_ };
+}
+
+template<typename S, typename K, typename H>
+FlatIterator<S> FlatTable<S, K, H>::end() noexcept {
+    return { slots_, ctrl_, capacity_, capacity_ };
+}
+
+template<typename S, typename K, typename H>
+FlatIterator<const S> FlatTable<S, K, H>::begin() const noexcept {
+    return { slots_, ctrl_, 0, capacity_ };
+}
+
+template<typename S, typename K, typename H>
+FlatIterator<const S> FlatTable<S, K, H>::end() const noexcept {
+    return { slots_, ctrl_, capacity_, capacity_ };
+}
+
+template<typename S, typename K, typename H>
+const K &FlatTable<S, K, H>::keyOf(const S &slot) noexcept {
+    if constexpr (std::is_same_v<S, K>)
+        return slot;
+    else
+        return slot.key;
+}
+
+template<typename S, typename K, typename H>
+u8 FlatTable<S, K, H>::h2Of(u64 hash) noexcept {
+    return static_cast<u8>(hash & FLAT_H2_MASK);
+}
+
+template<typename S, typename K, typename H>
+usize FlatTable<S, K, H>::h1Of(u64 hash) noexcept {
+    return static_cast<usize>(hash >> FLAT_H2_BITS);
+}
+
+template<typename S, typename K, typename H>
+usize FlatTable<S, K, H>::findFree(u64 hash) const noexcept {
+    const usize mask  = (capacity_ / FLAT_GROUP) - 1;
+
+    usize       group = h1Of(hash) & mask;
+    for (usize step = 1;; ++step) {
+        const usize base = group * FLAT_GROUP;
+        const u32   avail = utils::U8x16::load(ctrl_ + base).mask();
+
+        if (avail != 0)
+            return base + static_cast<usize>(std::countr_zero(avail));
+
+        group = (group + step) & mask;
+    }
+}
+
+template<typename S, typename K, typename H>
+void FlatTable<S, K, H>::resize(usize capacity) noexcept {
+    u8   *old_ctrl     = std::exchange(ctrl_, nullptr);
+    S    *old_slots    = std::exchange(slots_, nullptr);
+    usize old_capacity = std::exchange(capacity_, capacity);
+
+    if (capacity != 0) {
+        ctrl_  = std::allocator<u8>{}.allocate(capacity);
+        slots_ = std::allocator<S>{}.allocate(capacity);
+        std::memset(ctrl_, FLAT_EMPTY, capacity);
+    }
+
+    growth_left_ = flatMaxLoad(capacity) - size_;
+
+    for (usize i = 0; i < old_capacity; ++i) {
+        if (old_ctrl[i] >= FLAT_EMPTY) continue;
+
+        S          &old  = old_slots[i];
+        const u64   hash = H::hash(keyOf(old));
+        const usize idx  = findFree(hash);
+
+        ctrl_[idx]       = h2Of(hash);
+        std::construct_at(&slots_[idx], std::move(old));
+        std::destroy_at(&old);
+    }
+
+    if (old_capacity != 0) {
+        std::allocator<u8>{}.deallocate(old_ctrl, old_capacity);
+        std::allocator<S>{}.deallocate(old_slots, old_capacity);
+    }
+}
+
+template<typename S, typename K, typename H>
+void FlatTable<S, K, H>::release() noexcept {
+    if (capacity_ == 0) return;
+
+    clear();
+
+    std::allocator<u8>{}.deallocate(ctrl_, capacity_);
+    std::allocator<S>{}.deallocate(slots_, capacity_);
+
+    ctrl_        = nullptr;
+    slots_       = nullptr;
+    capacity_    = 0;
+    growth_left_ = 0;
+}
+
+} // namespace impl
+
+template<typename S>
+FlatIterator<S>::FlatIterator(S        *slots,
+                              const u8 *ctrl,
+                              usize     idx,
+                              usize     capacity) noexcept :
+    slots_{ slots },
+    ctrl_{ ctrl },
+    idx_{ idx },
+    capacity_{ capacity } {
+    skip();
+}
+
+template<typename S>
+S &FlatIterator<S>::operator*() const noexcept {
+    return slots_[idx_];
+}
+
+template<typename S>
+S *FlatIterator<S>::operator->() const noexcept {
+    return &slots_[idx_];
+}
+
+template<typename S>
+FlatIterator<S> &FlatIterator<S>::operator++() noexcept {
+    ++idx_;
+    skip();
+    return *this;
+}
+
+template<typename S>
+bool FlatIterator<S>::operator==(const FlatIterator &rhs) const noexcept {
+    return idx_ == rhs.idx_;
+}
+
+template<typename S>
+void FlatIterator<S>::skip() noexcept {
+    while (idx_ < capacity_ && ctrl_[idx_] >= impl::FLAT_EMPTY) ++idx_;
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+FlatMap<K, V, H>::FlatMap(FlatMap &&map) noexcept :
+    table_{ std::move(map.table_) } {}
+
+template<FlatStorable K, FlatStorable V, typename H>
+usize FlatMap<K, V, H>::size() const noexcept {
+    return table_.size();
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+usize FlatMap<K, V, H>::capacity() const noexcept {
+    return table_.capacity();
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+bool FlatMap<K, V, H>::empty() const noexcept {
+    return table_.size() == 0;
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+void FlatMap<K, V, H>::reserve(usize count) noexcept {
+    table_.reserve(count);
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+void FlatMap<K, V, H>::rehash(usize count) noexcept {
+    table_.rehash(count);
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+void FlatMap<K, V, H>::clear() noexcept {
+    table_.clear();
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+template<typename Q>
+    requires FlatLookup<K, H, Q>
+bool FlatMap<K, V, H>::contains(const Q &key) const noexcept {
+    return table_.find(key, H::hash(key)) != impl::FLAT_NPOS;
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+template<typename Q>
+    requires FlatLookup<K, H, Q>
+Result<V &> FlatMap<K, V, H>::find(const Q &key) noexcept {
+    const usize idx = table_.find(key, H::hash(key));
+    if (idx == impl::FLAT_NPOS) return Err::NO_SUCH_KEY;
+
+    return table_.slot(idx).value;
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+template<typename Q>
+    requires FlatLookup<K, H, Q>
+Result<const V &> FlatMap<K, V, H>::find(const Q &key) const noexcept {
+    const usize idx = table_.find(key, H::hash(key));
+    if (idx == impl::FLAT_NPOS) return Err::NO_SUCH_KEY;
+
+    return table_.slot(idx).value;
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+Result<V &> FlatMap<K, V, H>::insert(K &&key, V &&value) noexcept {
+    const u64 hash = H::hash(key);
+    if (table_.find(key, hash) != impl::FLAT_NPOS)
+        return Err::KEY_ALREADY_EXISTS;
+
+    Entry &entry = table_.slot(table_.prepare(hash));
+    std::construct_at(&entry, Entry{ std::move(key), std::move(value) });
+
+    return entry.value;
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+V &FlatMap<K, V, H>::insertOrAssign(K &&key, V &&value) noexcept {
+    const u64   hash = H::hash(key);
+    const usize idx  = table_.find(key, hash);
+
+    if (idx != impl::FLAT_NPOS) {
+        V &slot = table_.slot(idx).value;
+        std::destroy_at(&slot);
+        std::construct_at(&slot, std::move(value));
+        return slot;
+    }
+
+    Entry &entry = table_.slot(table_.prepare(hash));
+    std::construct_at(&entry, Entry{ std::move(key), std::move(value) });
+
+    return entry.value;
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+template<typename Q>
+    requires FlatLookup<K, H, Q>
+Status FlatMap<K, V, H>::erase(const Q &key) noexcept {
+    const usize idx = table_.find(key, H::hash(key));
+    if (idx == impl::FLAT_NPOS) return Err::NO_SUCH_KEY;
+
+    table_.erase(idx);
+    return {};
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+FlatIterator<FlatEntry<K, V>> FlatMap<K, V, H>::begin() noexcept {
+    return table_.begin();
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+FlatIterator<FlatEntry<K, V>> FlatMap<K, V, H>::end() noexcept {
+    return table_.end();
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+FlatIterator<const FlatEntry<K, V>> FlatMap<K, V, H>::begin() const noexcept {
+    return table_.begin();
+}
+
+template<FlatStorable K, FlatStorable V, typename H>
+FlatIterator<const FlatEntry<K, V>> FlatMap<K, V, H>::end() const noexcept {
+    return table_.end();
+}
+
+template<FlatStorable K, typename H>
+FlatSet<K, H>::FlatSet(FlatSet &&set) noexcept :
+    table_{ std::move(set.table_) } {}
+
+template<FlatStorable K, typename H>
+usize FlatSet<K, H>::size() const noexcept {
+    return table_.size();
+}
+
+template<FlatStorable K, typename H>
+usize FlatSet<K, H>::capacity() const noexcept {
+    return table_.capacity();
+}
+
+template<FlatStorable K, typename H>
+bool FlatSet<K, H>::empty() const noexcept {
+    return table_.size() == 0;
+}
+
+template<FlatStorable K, typename H>
+void FlatSet<K, H>::reserve(usize count) noexcept {
+    table_.reserve(count);
+}
+
+template<FlatStorable K, typename H>
+void FlatSet<K, H>::rehash(usize count) noexcept {
+    table_.rehash(count);
+}
+
+template<FlatStorable K, typename H>
+void FlatSet<K, H>::clear() noexcept {
+    table_.clear();
+}
+
+template<FlatStorable K, typename H>
+template<typename Q>
+    requires FlatLookup<K, H, Q>
+bool FlatSet<K, H>::contains(const Q &key) const noexcept {
+    return table_.find(key, H::hash(key)) != impl::FLAT_NPOS;
+}
+
+template<FlatStorable K, typename H>
+Status FlatSet<K, H>::insert(K &&key) noexcept {
+    const u64 hash = H::hash(key);
+    if (table_.find(key, hash) != impl::FLAT_NPOS)
+        return Err::KEY_ALREADY_EXISTS;
+
+    std::construct_at(&table_.slot(table_.prepare(hash)), std::move(key));
+    return {};
+}
+
+template<FlatStorable K, typename H>
+template<typename Q>
+    requires FlatLookup<K, H, Q>
+Status FlatSet<K, H>::erase(const Q &key) noexcept {
+    const usize idx = table_.find(key, H::hash(key));
+    if (idx == impl::FLAT_NPOS) return Err::NO_SUCH_KEY;
+
+    table_.erase(idx);
+    return {};
+}
+
+template<FlatStorable K, typename H>
+FlatIterator<const K> FlatSet<K, H>::begin() const noexcept {
+    return table_.begin();
+}
+
+template<FlatStorable K, typename H>
+FlatIterator<const K> FlatSet<K, H>::end() const noexcept {
+    return table_.end();
+}
+
+} // namespace cont
+} // namespace srr
+
+#endif // SRR_CONT_FLATMAP_HPP
@@ -0,0 +1,616 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONT_SMALLVECTOR_HPP
+#define SRR_CONT_SMALLVECTOR_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/memory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace cont {
+
+template<typename T>
+concept VectorStorable = utils::SafeDestructible<T> &&
+                         utils::SafeMovePolicy<T> && utils::SafeCopyPolicy<T>;
+
+namespace impl {
+
+constexpr usize VECTOR_GROWTH = 2;
+
+// Moves n elements from src to dst and ends the lifetime of the sources.
+// Safe for overlapping ranges as long as dst precedes src.
+template<VectorStorable T>
+static void relocateRange(T *dst, T *src, usize count) noexcept;
+
+template<VectorStorable T, usize N>
+class InlineStorage {
+public:
+    [[nodiscard]] T       *data() noexcept;
+    [[nodiscard]] const T *data() const noexcept;
+
+private:
+    alignas(T) std::array<std::byte, sizeof(T) * N> bytes_;
+};
+
+} // namespace impl
+
+// Vector with a fixed capacity of N elements stored inline, it never
+// allocates. Pushing into a full vector fails with CAPACITY_EXCEEDED.
+template<VectorStorable T, usize N>
+class InlineVector {
+public:
+    static constexpr usize CAPACITY = N;
+
+    [[nodiscard]] InlineVector() noexcept;
+    [[nodiscard]] InlineVector(const InlineVector &vec) noexcept
+        requires utils::SafeCopyable<T>;
+    [[nodiscard]] InlineVector(InlineVector &&vec) noexcept;
+
+    InlineVector &operator=(const InlineVector &vec) = delete;
+    InlineVector &operator=(InlineVector &&vec)      = delete;
+
+    ~InlineVector() noexcept;
+
+    [[nodiscard]] usize             size() const noexcept;
+    [[nodiscard]] usize             capacity() const noexcept;
+    [[nodiscard]] bool              empty() const noexcept;
+    [[nodiscard]] bool              full() const noexcept;
+
+    [[nodiscard]] T                *data() noexcept;
+    [[nodiscard]] const T          *data() const noexcept;
+
+    [[nodiscard]] T                &operator[](usize idx) noexcept;
+    [[nodiscard]] const T          &operator[](usize idx) const noexcept;
+
+    [[nodiscard]] Result<T &>       at(usize idx) noexcept;
+    [[nodiscard]] Result<const T &> at(usize idx) const noexcept;
+
+    [[nodiscard]] T                &front() noexcept;
+    [[nodiscard]] T                &back() noexcept;
+
+    Status push(const T &value) noexcept
+        requires utils::SafeCopyable<T>;
+    Status push(T &&value) noexcept;
+
+    template<typename... Args>
+        requires std::is_nothrow_constructible_v<T, Args...>
+    Result<T &> emplace(Args &&...args) noexcept;
+
+    // Removes the last element, the vector must not be empty.
+    void                      pop() noexcept;
+    Status                    erase(usize idx) noexcept;
+    Status                    swapErase(usize idx) noexcept;
+    void                      clear() noexcept;
+
+    [[nodiscard]] T          *begin() noexcept;
+    [[nodiscard]] T          *end() noexcept;
+    [[nodiscard]] const T    *begin() const noexcept;
+    [[nodiscard]] const T    *end() const noexcept;
+
+private:
+    impl::InlineStorage<T, N> storage_;
+    usize                     size_;
+};
+
+// Vector that keeps up to N elements inline and moves to the heap past that.
+// Growth relocates with memcpy for utils::Relocatable element types.
+template<VectorStorable T, usize N>
+class SmallVector {
+public:
+    static constexpr usize INLINE_CAPACITY = N;
+
+    [[nodiscard]] SmallVector() noexcept;
+    [[nodiscard]] SmallVector(const SmallVector &vec) noexcept
+        requires utils::SafeCopyable<T>;
+    [[nodiscard]] SmallVector(SmallVector &&vec) noexcept;
+
+    SmallVector &operator=(const SmallVector &vec) = delete;
+    SmallVector &operator=(SmallVector &&vec)      = delete;
+
+    ~SmallVector() noexcept;
+
+    [[nodiscard]] usize             size() const noexcept;
+    [[nodiscard]] usize             capacity() const noexcept;
+    [[nodiscard]] bool              empty() const noexcept;
+    [[nodiscard]] bool              isInline() const noexcept;
+
+    [[nodiscard]] T                *data() noexcept;
+    [[nodiscard]] const T          *data() const noexcept;
+
+    [[nodiscard]] T                &operator[](usize idx) noexcept;
+    [[nodiscard]] const T          &operator[](usize idx) const noexcept;
+
+    [[nodiscard]] Result<T &>       at(usize idx) noexcept;
+    [[nodiscard]] Result<const T &> at(usize idx) const noexcept;
+
+    [[nodiscard]] T                &front() noexcept;
+    [[nodiscard]] T                &back() noexcept;
+
+    void                            reserve(usize count) noexcept;
+
+    T &push(const T &value) noexcept
+        requires utils::SafeCopyable<T>;
+    T &push(T &&value) noexcept;
+
+    template<typename... Args>
+        requires std::is_nothrow_constructible_v<T, Args...>
+    T &emplace(Args &&...args) noexcept;
+
+    // Removes the last element, the vector must not be empty.
+    void                      pop() noexcept;
+    Status                    erase(usize idx) noexcept;
+    Status                    swapErase(usize idx) noexcept;
+    void                      clear() noexcept;
+
+    [[nodiscard]] T          *begin() noexcept;
+    [[nodiscard]] T          *end() noexcept;
+    [[nodiscard]] const T    *begin() const noexcept;
+    [[nodiscard]] const T    *end() const noexcept;
+
+private:
+    void                      grow(usize count) noexcept;
+    void                      release() noexcept;
+
+    T                        *data_;
+    usize                     size_;
+    usize                     capacity_;
+    impl::InlineStorage<T, N> inline_;
+};
+
+namespace impl {
+
+template<VectorStorable T>
+static void relocateRange(T *dst, T *src, usize count) noexcept {
+    if (count == 0 || dst == src) return;
+
+    if constexpr (utils::Relocatable<T>) {
+        std::memmove(static_cast<void *>(dst),
+                     static_cast<const void *>(src),
+                     count * sizeof(T));
+    } else {
+        for (usize i = 0; i < count; ++i) {
+            std::construct_at(dst + i, std::move(src[i]));
+            std::destroy_at(src + i);
+        }
+    }
+}
+
+// Element storage is raw bytes reinterpreted as T, elements are always
+// created with construct_at before they are read.
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+template<VectorStorable T, usize N>
+T *InlineStorage<T, N>::data() noexcept {
+    return std::launder(reinterpret_cast<T *>(bytes_.data()));
+}
+
+template<VectorStorable T, usize N>
+const T *InlineStorage<T, N>::data() const noexcept {
+    return std::launder(reinterpret_cast<const T *>(bytes_.data()));
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+} // namespace impl
+
+// InlineVector ---
+
+template<VectorStorable T, usize N>
+InlineVector<T, N>::InlineVector() noexcept : storage_{}, size_{ 0 } {}
+
+template<VectorStorable T, usize N>
+InlineVector<T, N>::InlineVector(const InlineVector &vec) noexcept
+    requires utils::SafeCopyable<T>
+    : storage_{}, size_{ vec.size_ } {
+    std::uninitialized_copy_n(vec.data(), size_, data());
+}
+
+template<VectorStorable T, usize N>
+InlineVector<T, N>::InlineVector(InlineVector &&vec) noexcept :
+    storage_{},
+    size_{ std::exchange(vec.size_, 0) } {
+    impl::relocateRange(data(), vec.data(), size_);
+}
+
+template<VectorStorable T, usize N>
+InlineVector<T, N>::~InlineVector() noexcept {
+    clear();
+}
+
+template<VectorStorable T, usize N>
+usize InlineVector<T, N>::size() const noexcept {
+    return size_;
+}
+
+template<VectorStorable T, usize N>
+usize InlineVector<T, N>::capacity() const noexcept {
+    return N;
+}
+
+template<VectorStorable T, usize N>
+bool InlineVector<T, N>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template<VectorStorable T, usize N>
+bool InlineVector<T, N>::full() const noexcept {
+    return size_ == N;
+}
+
+template<VectorStorable T, usize N>
+T *InlineVector<T, N>::data() noexcept {
+    return storage_.data();
+}
+
+template<VectorStorable T, usize N>
+const T *InlineVector<T, N>::data() const noexcept {
+    return storage_.data();
+}
+
+template<VectorStorable T, usize N>
+T &InlineVector<T, N>::operator[](usize idx) noexcept {
+    return data()[idx];
+}
+
+template<VectorStorable T, usize N>
+const T &InlineVector<T, N>::operator[](usize idx) const noexcept {
+    return data()[idx];
+}
+
+template<VectorStorable T, usize N>
+Result<T &> InlineVector<T, N>::at(usize idx) noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    return data()[idx];
+}
+
+template<VectorStorable T, usize N>
+Result<const T &> InlineVector<T, N>::at(usize idx) const noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    return data()[idx];
+}
+
+template<VectorStorable T, usize N>
+T &InlineVector<T, N>::front() noexcept {
+    return data()[0];
+}
+
+template<VectorStorable T, usize N>
+T &InlineVector<T, N>::back() noexcept {
+    return data()[size_ - 1];
+}
+
+template<VectorStorable T, usize N>
+Status InlineVector<T, N>::push(const T &value) noexcept
+    requires utils::SafeCopyable<T>
+{
+    if (size_ == N) return Err::CAPACITY_EXCEEDED;
+
+    std::construct_at(data() + size_, value);
+    ++size_;
+    return {};
+}
+
+template<VectorStorable T, usize N>
+Status InlineVector<T, N>::push(T &&value) noexcept {
+    if (size_ == N) return Err::CAPACITY_EXCEEDED;
+
+    std::construct_at(data() + size_, std::move(value));
+    ++size_;
+    return {};
+}
+
+template<VectorStorable T, usize N>
+template<typename... Args>
+    requires std::is_nothrow_constructible_v<T, Args...>
+Result<T &> InlineVector<T, N>::emplace(Args &&...args) noexcept {
+    if (size_ == N) return Err::CAPACITY_EXCEEDED;
+
+    T &slot = *std::construct_at(data() + size_, std::forward<Args>(args)...);
+    ++size_;
+    return slot;
+}
+
+template<VectorStorable T, usize N>
+void InlineVector<T, N>::pop() noexcept {
+    --size_;
+    std::destroy_at(data() + size_);
+}
+
+template<VectorStorable T, usize N>
+Status InlineVector<T, N>::erase(usize idx) noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    std::destroy_at(data() + idx);
+    impl::relocateRange(data() + idx, data() + idx + 1, size_ - idx - 1);
+    --size_;
+    return {};
+}
+
+template<VectorStorable T, usize N>
+Status InlineVector<T, N>::swapErase(usize idx) noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    std::destroy_at(data() + idx);
+    --size_;
+    if (idx != size_) impl::relocateRange(data() + idx, data() + size_, 1);
+    return {};
+}
+
+template<VectorStorable T, usize N>
+void InlineVector<T, N>::clear() noexcept {
+    std::destroy_n(data(), size_);
+    size_ = 0;
+}
+
+template<VectorStorable T, usize N>
+T *InlineVector<T, N>::begin() noexcept {
+    return data();
+}
+
+template<VectorStorable T, usize N>
+T *InlineVector<T, N>::end() noexcept {
+    return data() + size_;
+}
+
+template<VectorStorable T, usize N>
+const T *InlineVector<T, N>::begin() const noexcept {
+    return data();
+}
+
+template<VectorStorable T, usize N>
+const T *InlineVector<T, N>::end() const noexcept {
+    return data() + size_;
+}
+
+// SmallVector ---
+
+template<VectorStorable T, usize N>
+SmallVector<T, N>::SmallVector() noexcept :
+    data_{ nullptr },
+    size_{ 0 },
+    capacity_{ N },
+    inline_{} {
+    data_ = inline_.data();
+}
+
+template<VectorStorable T, usize N>
+SmallVector<T, N>::SmallVector(const SmallVector &vec) noexcept
+    requires utils::SafeCopyable<T>
+    : SmallVector{} {
+    reserve(vec.size_);
+    std::uninitialized_copy_n(vec.data_, vec.size_, data_);
+    size_ = vec.size_;
+}
+
+template<VectorStorable T, usize N>
+SmallVector<T, N>::SmallVector(SmallVector &&vec) noexcept : SmallVector{} {
+    if (vec.isInline()) {
+        impl::relocateRange(data_, vec.data_, vec.size_);
+        size_ = std::exchange(vec.size_, 0);
+        return;
+    }
+
+    data_     = std::exchange(vec.data_, vec.inline_.data());
+    size_     = std::exchange(vec.size_, 0);
+    capacity_ = std::exchange(vec.capacity_, N);
+}
+
+template<VectorStorable T, usize N>
+SmallVector<T, N>::~SmallVector() noexcept {
+    clear();
+    release();
+}
+
+template<VectorStorable T, usize N>
+usize SmallVector<T, N>::size() const noexcept {
+    return size_;
+}
+
+template<VectorStorable T, usize N>
+usize SmallVector<T, N>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<VectorStorable T, usize N>
+bool SmallVector<T, N>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template<VectorStorable T, usize N>
+bool SmallVector<T, N>::isInline() const noexcept {
+    return data_ == inline_.data();
+}
+
+template<VectorStorable T, usize N>
+T *SmallVector<T, N>::data() noexcept {
+    return data_;
+}
+
+template<VectorStorable T, usize N>
+const T *SmallVector<T, N>::data() const noexcept {
+    return data_;
+}
+
+template<VectorStorable T, usize N>
+T &SmallVector<T, N>::operator[](usize idx) noexcept {
+    return data_[idx];
+}
+
+template<VectorStorable T, usize N>
+const T &SmallVector<T, N>::operator[](usize idx) const noexcept {
+    return data_[idx];
+}
+
+template<VectorStorable T, usize N>
+Result<T &> SmallVector<T, N>::at(usize idx) noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    return data_[idx];
+}
+
+template<VectorStorable T, usize N>
+Result<const T &> SmallVector<T, N>::at(usize idx) const noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    return data_[idx];
+}
+
+template<VectorStorable T, usize N>
+T &SmallVector<T, N>::front() noexcept {
+    return data_[0];
+}
+
+template<VectorStorable T, usize N>
+T &SmallVector<T, N>::back() noexcept {
+    return data_[size_ - 1];
+}
+
+template<VectorStorable T, usize N>
+void SmallVector<T, N>::reserve(usize count) noexcept {
+    if (count > capacity_) grow(count);
+}
+
+template<VectorStorable T, usize N>
+T &SmallVector<T, N>::push(const T &value) noexcept
+    requires utils::SafeCopyable<T>
+{
+    return emplace(value);
+}
+
+template<VectorStorable T, usize N>
+T &SmallVector<T, N>::push(T &&value) noexcept {
+    return emplace(std::move(value));
+}
+
+template<VectorStorable T, usize N>
+template<typename... Args>
+    requires std::is_nothrow_constructible_v<T, Args...>
+T &SmallVector<T, N>::emplace(Args &&...args) noexcept {
+    if (size_ == capacity_) {
+        // Arguments may alias an element, build the value before growing.
+        // Parentheses match construct_at below, braces would narrow-check
+        // and prefer initializer_list constructors.
+        T value(std::forward<Args>(args)...);
+        grow(std::max(capacity_ * impl::VECTOR_GROWTH, size_ + 1));
+        return *std::construct_at(data_ + size_++, std::move(value));
+    }
+
+    return *std::construct_at(data_ + size_++, std::forward<Args>(args)...);
+}
+
+template<VectorStorable T, usize N>
+void SmallVector<T, N>::pop() noexcept {
+    --size_;
+    std::destroy_at(data_ + size_);
+}
+
+template<VectorStorable T, usize N>
+Status SmallVector<T, N>::erase(usize idx) noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    std::destroy_at(data_ + idx);
+    impl::relocateRange(data_ + idx, data_ + idx + 1, size_ - idx - 1);
+    --size_;
+    return {};
+}
+
+template<VectorStorable T, usize N>
+Status SmallVector<T, N>::swapErase(usize idx) noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    std::destroy_at(data_ + idx);
+    --size_;
+    if (idx != size_) impl::relocateRange(data_ + idx, data_ + size_, 1);
+    return {};
+}
+
+template<VectorStorable T, usize N>
+void SmallVector<T, N>::clear() noexcept {
+    std::destroy_n(data_, size_);
+    size_ = 0;
+}
+
+template<VectorStorable T, usize N>
+T *SmallVector<T, N>::begin() noexcept {
+    return data_;
+}
+
+template<VectorStorable T, usize N>
+T *SmallVector<T, N>::end() noexcept {
+    return data_ + size_;
+}
+
+template<VectorStorable T, usize N>
+const T *SmallVector<T, N>::begin() const noexcept {
+    return data_;
+}
+
+template<VectorStorable T, usize N>
+const T *SmallVector<T, N>::end() const noexcept {
+    return data_ + size_;
+}
+
+template<VectorStorable T, usize N>
+void SmallVector<T, N>::grow(usize count) noexcept {
+    T *heap = std::allocator<T>{}.allocate(count);
+    impl::relocateRange(heap, data_, size_);
+
+    release();
+    data_     = heap;
+    capacity_ = count;
+}
+
+template<VectorStorable T, usize N>
+void SmallVector<T, N>::release() noexcept {
+    if (isInline()) return;
+
+    std::allocator<T>{}.deallocate(data_, capacity_);
+    data_     = inline_.data();
+    capacity_ = N;
+}
+
+} // namespace cont
+} // namespace srr
+
+#endif // SRR_CONT_SMALLVECTOR_HPP
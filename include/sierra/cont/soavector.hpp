@@ -0,0 +1,455 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_CONT_SOAVECTOR_HPP
+#define SRR_CONT_SOAVECTOR_HPP
+
+#include "sierra/cont/smallvector.hpp"
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/consteval.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <utility>
+
+inline namespace srr {
+namespace cont {
+
+namespace impl {
+
+// Columns start on a cache line so vectorized loops see aligned data.
+constexpr usize SOA_ALIGN = 64;
+
+} // namespace impl
+
+// One row of a SoAVector, a bundle of references into each column.
+template<typename... Ts>
+class SoARow {
+public:
+    [[nodiscard]] explicit SoARow(Ts &...refs) noexcept;
+
+    template<usize I>
+    [[nodiscard]] std::tuple_element_t<I, std::tuple<Ts...>> &get()
+        const noexcept;
+
+private:
+    std::tuple<Ts &...> refs_;
+};
+
+template<typename V, typename R>
+class SoAIterator {
+public:
+    [[nodiscard]] SoAIterator(V &vec, usize idx) noexcept;
+
+    [[nodiscard]] R    operator*() const noexcept;
+    SoAIterator       &operator++() noexcept;
+
+    [[nodiscard]] bool operator==(const SoAIterator &rhs) const noexcept;
+
+private:
+    V    *vec_;
+    usize idx_;
+};
+
+// Structure of arrays, each field lives in its own contiguous column. Rows
+// are addressed by index and all columns always have the same length.
+template<VectorStorable... Fields>
+class SoAVector {
+public:
+    static constexpr usize COLUMNS = sizeof...(Fields);
+
+    template<usize I>
+    using Column   = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    using Row      = SoARow<Fields...>;
+    using ConstRow = SoARow<const Fields...>;
+
+    [[nodiscard]] SoAVector() noexcept;
+    [[nodiscard]] SoAVector(SoAVector &&vec) noexcept;
+
+    SoAVector(const SoAVector &vec)            = delete;
+    SoAVector &operator=(const SoAVector &vec) = delete;
+    SoAVector &operator=(SoAVector &&vec)      = delete;
+
+    ~SoAVector() noexcept;
+
+    [[nodiscard]] usize size() const noexcept;
+    [[nodiscard]] usize capacity() const noexcept;
+    [[nodiscard]] bool  empty() const noexcept;
+
+    void                reserve(usize count) noexcept;
+    void                clear() noexcept;
+
+    template<usize I>
+    [[nodiscard]] std::span<Column<I>> column() noexcept;
+
+    template<usize I>
+    [[nodiscard]] std::span<const Column<I>> column() const noexcept;
+
+    [[nodiscard]] Row      row(usize idx) noexcept;
+    [[nodiscard]] ConstRow row(usize idx) const noexcept;
+
+    void                   push(Fields... values) noexcept;
+
+    // Appends one row per element, every span must have the same length.
+    Status                 pushBulk(std::span<const Fields>... values) noexcept
+        requires(utils::SafeCopyable<Fields> && ...);
+
+    // Removes the last row, the vector must not be empty.
+    void   pop() noexcept;
+    Status erase(usize idx) noexcept;
+    Status eraseRange(usize first, usize count) noexcept;
+    Status swapErase(usize idx) noexcept;
+
+    // Calls func with a reference to every field of each row in order.
+    template<typename F>
+    void forEach(F &&func) noexcept;
+
+    template<typename F>
+    void forEach(F &&func) const noexcept;
+
+    [[nodiscard]] SoAIterator<SoAVector, Row> begin() noexcept;
+    [[nodiscard]] SoAIterator<SoAVector, Row> end() noexcept;
+    [[nodiscard]] SoAIterator<const SoAVector, ConstRow> begin() const noexcept;
+    [[nodiscard]] SoAIterator<const SoAVector, ConstRow> end() const noexcept;
+
+private:
+    template<usize... I>
+    [[nodiscard]] Row row(usize idx, std::index_sequence<I...> seq) noexcept;
+
+    template<usize... I>
+    [[nodiscard]] ConstRow row(usize                     idx,
+                               std::index_sequence<I...> seq) const noexcept;
+
+    template<typename F, usize... I>
+    void forEach(F &&func, std::index_sequence<I...> seq) noexcept;
+
+    template<typename F, usize... I>
+    void forEach(F &&func, std::index_sequence<I...> seq) const noexcept;
+
+    void grow(usize count) noexcept;
+    void release() noexcept;
+
+    std::tuple<Fields *...> columns_;
+    usize                   size_;
+    usize                   capacity_;
+};
+
+// SoARow ---
+
+template<typename... Ts>
+SoARow<Ts...>::SoARow(Ts &...refs) noexcept : refs_{ refs... } {}
+
+template<typename... Ts>
+template<usize I>
+std::tuple_element_t<I, std::tuple<Ts...>> &SoARow<Ts...>::get()
+    const noexcept {
+    return std::get<I>(refs_);
+}
+
+// SoAIterator ---
+
+template<typename V, typename R>
+SoAIterator<V, R>::SoAIterator(V &vec, usize idx) noexcept :
+    vec_{ &vec },
+    idx_{ idx } {}
+
+template<typename V, typename R>
+R SoAIterator<V, R>::operator*() const noexcept {
+    return vec_->row(idx_);
+}
+
+template<typename V, typename R>
+SoAIterator<V, R> &SoAIterator<V, R>::operator++() noexcept {
+    ++idx_;
+    return *this;
+}
+
+template<typename V, typename R>
+bool SoAIterator<V, R>::operator==(const SoAIterator &rhs) const noexcept {
+    return idx_ == rhs.idx_;
+}
+
+// SoAVector ---
+
+template<VectorStorable... Fields>
+SoAVector<Fields...>::SoAVector() noexcept :
+    columns_{},
+    size_{ 0 },
+    capacity_{ 0 } {}
+
+template<VectorStorable... Fields>
+SoAVector<Fields...>::SoAVector(SoAVector &&vec) noexcept :
+    columns_{ std::exchange(vec.columns_, {}) },
+    size_{ std::exchange(vec.size_, 0) },
+    capacity_{ std::exchange(vec.capacity_, 0) } {}
+
+template<VectorStorable... Fields>
+SoAVector<Fields...>::~SoAVector() noexcept {
+    clear();
+    release();
+}
+
+template<VectorStorable... Fields>
+usize SoAVector<Fields...>::size() const noexcept {
+    return size_;
+}
+
+template<VectorStorable... Fields>
+usize SoAVector<Fields...>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<VectorStorable... Fields>
+bool SoAVector<Fields...>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template<VectorStorable... Fields>
+void SoAVector<Fields...>::reserve(usize count) noexcept {
+    if (count > capacity_) grow(count);
+}
+
+template<VectorStorable... Fields>
+void SoAVector<Fields...>::clear() noexcept {
+    utils::forEachIndex<COLUMNS>(
+        [&]<usize I> { std::destroy_n(std::get<I>(columns_), size_); });
+    size_ = 0;
+}
+
+template<VectorStorable... Fields>
+template<usize I>
+std::span<typename SoAVector<Fields...>::template Column<I>>
+SoAVector<Fields...>::column() noexcept {
+    return { std::get<I>(columns_), size_ };
+}
+
+template<VectorStorable... Fields>
+template<usize I>
+std::span<const typename SoAVector<Fields...>::template Column<I>>
+SoAVector<Fields...>::column() const noexcept {
+    return { std::get<I>(columns_), size_ };
+}
+
+template<VectorStorable... Fields>
+typename SoAVector<Fields...>::Row SoAVector<Fields...>::row(
+    usize idx) noexcept {
+    return row(idx, std::index_sequence_for<Fields...>{});
+}
+
+template<VectorStorable... Fields>
+typename SoAVector<Fields...>::ConstRow SoAVector<Fields...>::row(
+    usize idx) const noexcept {
+    return row(idx, std::index_sequence_for<Fields...>{});
+}
+
+template<VectorStorable... Fields>
+void SoAVector<Fields...>::push(Fields... values) noexcept {
+    if (size_ == capacity_)
+        grow(std::max(capacity_ * impl::VECTOR_GROWTH, size_ + 1));
+
+    std::tuple<Fields &...> refs{ values... };
+    utils::forEachIndex<COLUMNS>([&]<usize I> {
+        std::construct_at(std::get<I>(columns_) + size_,
+                          std::move(std::get<I>(refs)));
+    });
+    ++size_;
+}
+
+template<VectorStorable... Fields>
+Status SoAVector<Fields...>::pushBulk(
+    std::span<const Fields>... values) noexcept
+    requires(utils::SafeCopyable<Fields> && ...)
+{
+    const std::tuple<std::span<const Fields>...> spans{ values... };
+    const usize count = std::get<0>(spans).size();
+
+    if (((values.size() != count) || ...)) return Err::INDEX_OUT_OF_RANGE;
+
+    reserve(size_ + count);
+    utils::forEachIndex<COLUMNS>([&]<usize I> {
+        std::uninitialized_copy_n(std::get<I>(spans).data(),
+                                  count,
+                                  std::get<I>(columns_) + size_);
+    });
+    size_ += count;
+    return {};
+}
+
+template<VectorStorable... Fields>
+void SoAVector<Fields...>::pop() noexcept {
+    --size_;
+    utils::forEachIndex<COLUMNS>(
+        [&]<usize I> { std::destroy_at(std::get<I>(columns_) + size_); });
+}
+
+template<VectorStorable... Fields>
+Status SoAVector<Fields...>::erase(usize idx) noexcept {
+    return eraseRange(idx, 1);
+}
+
+template<VectorStorable... Fields>
+Status SoAVector<Fields...>::eraseRange(usize first, usize count) noexcept {
+    if (first > size_ || count > size_ - first) return Err::INDEX_OUT_OF_RANGE;
+
+    const usize tail = size_ - first - count;
+    utils::forEachIndex<COLUMNS>([&]<usize I> {
+        Column<I> *col = std::get<I>(columns_);
+        std::destroy_n(col + first, count);
+        impl::relocateRange(col + first, col + first + count, tail);
+    });
+    size_ -= count;
+    return {};
+}
+
+template<VectorStorable... Fields>
+Status SoAVector<Fields...>::swapErase(usize idx) noexcept {
+    if (idx >= size_) return Err::INDEX_OUT_OF_RANGE;
+
+    --size_;
+    utils::forEachIndex<COLUMNS>([&]<usize I> {
+        Column<I> *col = std::get<I>(columns_);
+        std::destroy_at(col + idx);
+        if (idx != size_) impl::relocateRange(col + idx, col + size_, 1);
+    });
+    return {};
+}
+
+template<VectorStorable... Fields>
+template<typename F>
+void SoAVector<Fields...>::forEach(F &&func) noexcept {
+    forEach(std::forward<F>(func), std::index_sequence_for<Fields...>{});
+}
+
+template<VectorStorable... Fields>
+template<typename F>
+void SoAVector<Fields...>::forEach(F &&func) const noexcept {
+    forEach(std::forward<F>(func), std::index_sequence_for<Fields...>{});
+}
+
+template<VectorStorable... Fields>
+SoAIterator<SoAVector<Fields...>, typename SoAVector<Fields...>::Row>
+SoAVector<Fields...>::begin() noexcept {
+    return { *this, 0 };
+}
+
+template<VectorStorable... Fields>
+SoAIterator<SoAVector<Fields...>, typename SoAVector<Fields...>::Row>
+SoAVector<Fields...>::end() noexcept {
+    return { *this, size_ };
+}
+
+template<VectorStorable... Fields>
+SoAIterator<const SoAVector<Fields...>,
+            typename SoAVector<Fields...>::ConstRow>
+SoAVector<Fields...>::begin() const noexcept {
+    return { *this, 0 };
+}
+
+template<VectorStorable... Fields>
+SoAIterator<const SoAVector<Fields...>,
+            typename SoAVector<Fields...>::ConstRow>
+SoAVector<Fields...>::end() const noexcept {
+    return { *this, size_ };
+}
+
+template<VectorStorable... Fields>
+template<usize... I>
+typename SoAVector<Fields...>::Row SoAVector<Fields...>::row(
+    usize idx,
+    [[maybe_unused]] std::index_sequence<I...> seq) noexcept {
+    return Row{ std::get<I>(columns_)[idx]... };
+}
+
+template<VectorStorable... Fields>
+template<usize... I>
+typename SoAVector<Fields...>::ConstRow SoAVector<Fields...>::row(
+    usize idx,
+    [[maybe_unused]] std::index_sequence<I...> seq) const noexcept {
+    return ConstRow{ std::get<I>(columns_)[idx]... };
+}
+
+template<VectorStorable... Fields>
+template<typename F, usize... I>
+void SoAVector<Fields...>::forEach(
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    F                                        &&func,
+    [[maybe_unused]] std::index_sequence<I...> seq) noexcept {
+    for (usize idx = 0; idx < size_; ++idx) func(std::get<I>(columns_)[idx]...);
+}
+
+template<VectorStorable... Fields>
+template<typename F, usize... I>
+void SoAVector<Fields...>::forEach(
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    F                                        &&func,
+    [[maybe_unused]] std::index_sequence<I...> seq) const noexcept {
+    for (usize idx = 0; idx < size_; ++idx) {
+        func(static_cast<const Fields &>(std::get<I>(columns_)[idx])...);
+    }
+}
+
+template<VectorStorable... Fields>
+void SoAVector<Fields...>::grow(usize count) noexcept {
+    utils::forEachIndex<COLUMNS>([&]<usize I> {
+        Column<I> *&col  = std::get<I>(columns_);
+        Column<I>  *heap = static_cast<Column<I> *>(
+            ::operator new(count * sizeof(Column<I>),
+                           std::align_val_t{ impl::SOA_ALIGN }));
+
+        impl::relocateRange(heap, col, size_);
+        if (col != nullptr)
+            ::operator delete(col, std::align_val_t{ impl::SOA_ALIGN });
+
+        col = heap;
+    });
+    capacity_ = count;
+}
+
+template<VectorStorable... Fields>
+void SoAVector<Fields...>::release() noexcept {
+    utils::forEachIndex<COLUMNS>([&]<usize I> {
+        Column<I> *&col = std::get<I>(columns_);
+        if (col != nullptr)
+            ::operator delete(col, std::align_val_t{ impl::SOA_ALIGN });
+
+        col = nullptr;
+    });
+    capacity_ = 0;
+}
+
+} // namespace cont
+} // namespace srr
+
+#endif // SRR_CONT_SOAVECTOR_HPP
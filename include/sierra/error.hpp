@@ -43,13 +43,19 @@ enum class Err : u8 {
     // none
     FAILURE,
     NOT_IMPLEMENTED,
+    OUT_OF_MEMORY,
+    CAPACITY_EXCEEDED,
+    CANCELLED,
 
     // none : access
     INDEX_OUT_OF_RANGE,
     NO_SUCH_KEY,
+    KEY_ALREADY_EXISTS,
+    CONTAINER_EMPTY,
 
     // none : parse
     INVALID_NUMBER,
+    INVALID_UTF8,
 
     // fs : access
     FS_NO_SUCH_PATH,
@@ -59,6 +65,13 @@ enum class Err : u8 {
     FS_FILE_ALREADY_EXISTS,
     FS_DIR_ALREADY_EXISTS,
     FS_FAILED_TO_OPEN,
+    FS_FAILED_TO_READ,
+    FS_FAILED_TO_WRITE,
+
+    // io : access
+    IO_FAILED_TO_OPEN,
+    IO_FAILED_TO_WATCH,
+    IO_FAILED_TO_WAIT,
 
     // json : cast
     JSON_BAD_CAST,
@@ -98,6 +111,7 @@ enum class ErrType : u8 {
     FSYS,
     JSON,
     CLI,
+    IO,
 };
 
 enum class ErrSubtype : u8 {
@@ -122,8 +136,11 @@ struct ErrInfo {
         return {
             .msg = "Ok",
         };
-    case Err::FAILURE        : return { .msg = "Failure" };
-    case Err::NOT_IMPLEMENTED: return { .msg = "Not implemented" };
+    case Err::FAILURE          : return { .msg = "Failure" };
+    case Err::NOT_IMPLEMENTED  : return { .msg = "Not implemented" };
+    case Err::OUT_OF_MEMORY    : return { .msg = "Out of memory" };
+    case Err::CAPACITY_EXCEEDED: return { .msg = "Capacity exceeded" };
+    case Err::CANCELLED        : return { .msg = "Cancelled" };
 
     case Err::INDEX_OUT_OF_RANGE:
         return {
@@ -135,12 +152,27 @@ struct ErrInfo {
             .msg     = "No such key",
             .subtype = ErrSubtype::ACCESS,
         };
+    case Err::KEY_ALREADY_EXISTS:
+        return {
+            .msg     = "Key already exists",
+            .subtype = ErrSubtype::ACCESS,
+        };
+    case Err::CONTAINER_EMPTY:
+        return {
+            .msg     = "Container is empty",
+            .subtype = ErrSubtype::ACCESS,
+        };
 
     case Err::INVALID_NUMBER:
         return {
             .msg     = "Invalid number",
             .subtype = ErrSubtype::PARSE,
         };
+    case Err::INVALID_UTF8:
+        return {
+            .msg     = "Invalid UTF-8 sequence",
+            .subtype = ErrSubtype::PARSE,
+        };
 
     case Err::FS_NO_SUCH_PATH:
         return {
@@ -185,6 +217,37 @@ struct ErrInfo {
             .type    = ErrType::FSYS,
             .subtype = ErrSubtype::ACCESS,
         };
+    case Err::FS_FAILED_TO_READ:
+        return {
+            .msg     = "Failed to read file",
+            .type    = ErrType::FSYS,
+            .subtype = ErrSubtype::ACCESS,
+        };
+    case Err::FS_FAILED_TO_WRITE:
+        return {
+            .msg     = "Failed to write file",
+            .type    = ErrType::FSYS,
+            .subtype = ErrSubtype::ACCESS,
+        };
+
+    case Err::IO_FAILED_TO_OPEN:
+        return {
+            .msg     = "Failed to create I/O object",
+            .type    = ErrType::IO,
+            .subtype = ErrSubtype::ACCESS,
+        };
+    case Err::IO_FAILED_TO_WATCH:
+        return {
+            .msg     = "Failed to watch descriptor",
+            .type    = ErrType::IO,
+            .subtype = ErrSubtype::ACCESS,
+        };
+    case Err::IO_FAILED_TO_WAIT:
+        return {
+            .msg     = "Failed to wait for I/O events",
+            .type    = ErrType::IO,
+            .subtype = ErrSubtype::ACCESS,
+        };
 
     case Err::JSON_BAD_CAST:
         return {
@@ -334,6 +397,7 @@ struct ErrInfo {
     case ErrType::FSYS: return "[fsys]";
     case ErrType::JSON: return "[json]";
     case ErrType::CLI : return "[cli]";
+    case ErrType::IO  : return "[io]";
     }
 }
 
@@ -33,15 +33,25 @@
 #include "sierra/error.hpp"
 #include "sierra/fsys/path.hpp"
 #include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/target.hpp"
 
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <utility>
 
+#ifdef SRR_TARGET_UNIX
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // SRR_TARGET_UNIX
+
 inline namespace srr {
 namespace fsys {
 
@@ -58,14 +68,65 @@ public:
 
     inline ~FileRead() noexcept;
 
-    [[nodiscard]] constexpr bool     opened() const noexcept;
+    [[nodiscard]] constexpr bool       opened() const noexcept;
+
+    [[nodiscard]] inline std::string   dump() noexcept;
 
-    [[nodiscard]] inline std::string dump() noexcept;
+    // Fills buffer from the current position, returns the bytes read. Fails
+    // with FS_FAILED_TO_READ, zero bytes means the end of the file.
+    [[nodiscard]] inline Result<usize> read(std::span<char> buffer) noexcept;
 
 private:
     std::unique_ptr<std::ifstream> stream_;
 };
 
+class [[nodiscard]] FileWrite {
+public:
+    FileWrite(const FileWrite &file)            = delete;
+    FileWrite()                                 = delete;
+
+    FileWrite &operator=(const FileWrite &file) = delete;
+    FileWrite &operator=(FileWrite &&file)      = delete;
+
+    [[nodiscard]] inline FileWrite(FileWrite &&file) noexcept;
+    [[nodiscard]] inline FileWrite(const Path &path) noexcept;
+
+    inline ~FileWrite() noexcept;
+
+    [[nodiscard]] inline bool    opened() const noexcept;
+
+    // Appends all of data, fails with FS_FAILED_TO_WRITE.
+    [[nodiscard]] inline Status  write(std::span<const char> data) noexcept;
+    [[nodiscard]] inline Status  flush() noexcept;
+
+private:
+    std::unique_ptr<std::ofstream> stream_;
+};
+
+// Read-only mapping of a whole file, pages are loaded on first touch.
+class [[nodiscard]] FileMap {
+public:
+    FileMap(const FileMap &file)            = delete;
+    FileMap()                               = delete;
+
+    FileMap &operator=(const FileMap &file) = delete;
+    FileMap &operator=(FileMap &&file)      = delete;
+
+    [[nodiscard]] inline FileMap(FileMap &&file) noexcept;
+
+    inline ~FileMap() noexcept;
+
+    [[nodiscard]] inline std::span<const char> data() const noexcept;
+
+private:
+    friend class File;
+
+    [[nodiscard]] inline FileMap(void *data, usize size) noexcept;
+
+    void *data_;
+    usize size_;
+};
+
 class [[nodiscard]] File {
 public:
     File(const File &file)            = delete;
@@ -79,7 +140,12 @@ public:
     [[nodiscard]] inline File(File &&file) noexcept;
     [[nodiscard]] inline File(Path &&path) noexcept;
 
-    inline Result<FileRead> read() const noexcept;
+    inline Result<FileRead>  read() const noexcept;
+
+    // Truncates the file, creating it when missing.
+    inline Result<FileWrite> write() const noexcept;
+
+    inline Result<FileMap>   map() const noexcept;
 
 private:
     Path path_;
@@ -113,6 +179,60 @@ inline std::string FileRead::dump() noexcept {
     return buffer.str();
 }
 
+inline Result<usize> FileRead::read(std::span<char> buffer) noexcept {
+    stream_->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (stream_->bad()) return Err::FS_FAILED_TO_READ;
+
+    return static_cast<usize>(stream_->gcount());
+}
+
+inline FileWrite::FileWrite(FileWrite &&file) noexcept :
+    stream_{ std::move(file.stream_) } {}
+
+inline FileWrite::FileWrite(const Path &path) noexcept :
+    stream_{ std::make_unique<std::ofstream>(
+        path.get(), std::ios::binary | std::ios::trunc) } {}
+
+inline FileWrite::~FileWrite() noexcept {
+    if (stream_ == nullptr) return;
+
+    if (stream_->is_open()) stream_->close();
+}
+
+inline bool FileWrite::opened() const noexcept { return stream_->is_open(); }
+
+inline Status FileWrite::write(std::span<const char> data) noexcept {
+    stream_->write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!stream_->good()) return Err::FS_FAILED_TO_WRITE;
+
+    return {};
+}
+
+inline Status FileWrite::flush() noexcept {
+    stream_->flush();
+    if (!stream_->good()) return Err::FS_FAILED_TO_WRITE;
+
+    return {};
+}
+
+inline FileMap::FileMap(FileMap &&file) noexcept :
+    data_{ std::exchange(file.data_, nullptr) },
+    size_{ std::exchange(file.size_, 0) } {}
+
+inline FileMap::FileMap(void *data, usize size) noexcept :
+    data_{ data },
+    size_{ size } {}
+
+inline FileMap::~FileMap() noexcept {
+    if (data_ == nullptr) return;
+
+    ::munmap(data_, size_);
+}
+
+inline std::span<const char> FileMap::data() const noexcept {
+    return { static_cast<const char *>(data_), size_ };
+}
+
 inline File::File(File &&file) noexcept : path_{ std::move(file.path_) } {}
 
 inline File::File(Path &&path) noexcept : path_{ std::move(path) } {}
@@ -127,6 +247,46 @@ inline Result<FileRead> File::read() const noexcept {
     return read;
 }
 
+inline Result<FileWrite> File::write() const noexcept {
+    if (path_.isDir()) return Err::FS_DIR_ALREADY_EXISTS;
+
+    // A bare file name has an empty parent, the working directory.
+    const Path parent = path_.parent();
+    if (!parent.get().empty() && !parent.isDir()) return Err::FS_NO_SUCH_PARENT;
+
+    FileWrite write{ path_ };
+    if (!write.opened()) return Err::FS_FAILED_TO_OPEN;
+
+    return write;
+}
+
+inline Result<FileMap> File::map() const noexcept {
+    if (!path_.isPath()) return Err::FS_NO_SUCH_PATH;
+    if (!path_.isFile()) return Err::FS_NO_SUCH_FILE;
+
+    const Fd fd = ::open(path_.get().c_str(), O_RDONLY);
+    if (fd < 0) return Err::FS_FAILED_TO_OPEN;
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return Err::FS_FAILED_TO_OPEN;
+    }
+
+    // Mapping zero bytes fails, an empty file is an empty view.
+    const usize size = static_cast<usize>(info.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return FileMap{ nullptr, 0 };
+    }
+
+    void *const data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) return Err::FS_FAILED_TO_OPEN;
+
+    return FileMap{ data, size };
+}
+
 inline Result<File> openFile(Path &&path) noexcept {
     if (!path.isPath()) return Err::FS_NO_SUCH_PATH;
     if (!path.isFile()) return Err::FS_NO_SUCH_FILE;
@@ -144,7 +304,7 @@ inline Result<File> openFile(std::string_view path) noexcept {
 }
 
 inline Result<File> makeFile(Path &&path) noexcept {
-    if (!path.isPath()) return Err::FS_FILE_ALREADY_EXISTS;
+    if (path.isPath()) return Err::FS_FILE_ALREADY_EXISTS;
 
     const Path parent = path.parent();
 
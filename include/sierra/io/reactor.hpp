@@ -0,0 +1,706 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_IO_REACTOR_HPP
+#define SRR_IO_REACTOR_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/io/timer.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/target.hpp"
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <span>
+
+#if defined(SRR_TARGET_LINUX)
+    #include <pthread.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/signalfd.h>
+    #include <sys/timerfd.h>
+    #include <unistd.h>
+#elif defined(SRR_TARGET_APPLE)
+    #include <sys/event.h>
+    #include <unistd.h>
+#else
+    #error "Reactor needs epoll or kqueue!"
+#endif // SRR_TARGET_LINUX
+
+inline namespace srr {
+namespace io {
+
+struct IoWatch;
+struct SignalWatch;
+
+using ReactorClock   = std::chrono::steady_clock;
+
+using IoMask         = u32;
+using IoCallback     = void (*)(IoWatch &watch, IoMask events) noexcept;
+using SignalCallback = void (*)(SignalWatch &watch, i32 signal) noexcept;
+
+constexpr IoMask IO_READ      = 1U << 0U;
+constexpr IoMask IO_WRITE     = 1U << 1U;
+constexpr IoMask IO_HANGUP    = 1U << 2U;
+constexpr IoMask IO_ERROR     = 1U << 3U;
+
+constexpr i32    POLL_FOREVER = -1;
+
+namespace impl {
+
+constexpr usize REACTOR_BATCH   = 256;
+constexpr usize REACTOR_SIGNALS = NSIG;
+
+constexpr ReactorClock::duration REACTOR_DEFAULT_TICK =
+    std::chrono::milliseconds{ 1 };
+
+#if defined(SRR_TARGET_LINUX)
+using ReactorEvent = epoll_event;
+#elif defined(SRR_TARGET_APPLE)
+using ReactorEvent = struct kevent;
+#endif // SRR_TARGET_LINUX
+
+} // namespace impl
+
+// Descriptor registration, owned by the caller and referenced by the reactor
+// until removed. Readiness is edge-triggered, so the callback must drain the
+// descriptor until it would block, which means it must be non-blocking.
+struct IoWatch {
+    Fd         fd;
+    IoMask     interest;
+    IoCallback callback;
+    void      *user;
+};
+
+struct SignalWatch {
+    SignalCallback callback;
+    void          *user;
+};
+
+struct ReactorConfig {
+    ReactorClock::duration tick;
+};
+
+[[nodiscard]] ReactorConfig makeReactorConfig() noexcept;
+
+// Single-threaded event loop over epoll on Linux and kqueue on Apple. Ready
+// events are fetched in fixed batches and dispatched in place, timers run on
+// a TimerWheel driven by a one-shot kernel timer set for the wheel's next
+// expiry, so the loop does not allocate per event or wake on idle ticks.
+//
+// Reactor belongs to the thread that runs it, only stop() and wake() may be
+// called from other threads. Callbacks may add, modify or remove any watch
+// and schedule or cancel any timer.
+class Reactor {
+public:
+    [[nodiscard]] explicit Reactor(ReactorConfig config) noexcept;
+
+    Reactor(const Reactor &reactor)            = delete;
+    Reactor(Reactor &&reactor)                 = delete;
+    Reactor &operator=(const Reactor &reactor) = delete;
+    Reactor &operator=(Reactor &&reactor)      = delete;
+
+    ~Reactor() noexcept;
+
+    // Whether the kernel objects were created, every call fails otherwise.
+    [[nodiscard]] Status        status() const noexcept;
+
+    Status                      add(IoWatch &watch) noexcept;
+    Status                      modify(IoWatch &watch) noexcept;
+    void                        remove(IoWatch &watch) noexcept;
+
+    // Routes signals to watch instead of their handlers. Signals are blocked
+    // on the calling thread, so this must run before other threads are
+    // started for the signals to stay blocked everywhere. On Apple they are
+    // ignored instead, and their previous actions restored by the
+    // destructor.
+    Status watchSignals(std::span<const i32> signals,
+                        SignalWatch         &watch) noexcept;
+
+    // Rounded up to whole ticks.
+    void   schedule(Timer &timer, ReactorClock::duration delay) noexcept;
+    void   cancel(Timer &timer) noexcept;
+
+    // Waits up to timeout milliseconds for one batch of events and expires
+    // due timers, the value is the number of callbacks run.
+    [[nodiscard]] Result<usize> poll(i32 timeout) noexcept;
+
+    // Polls until stop().
+    Status                      run() noexcept;
+
+    void                        stop() noexcept;
+    void                        wake() noexcept;
+
+private:
+    [[nodiscard]] u64 tick() const noexcept;
+
+    usize             dispatch(impl::ReactorEvent &event) noexcept;
+    usize             expire() noexcept;
+
+    // Sets the kernel timer to fire once at the given tick.
+    void              arm(u64 deadline) noexcept;
+    void              disarm() noexcept;
+
+#if defined(SRR_TARGET_LINUX)
+    usize    drainSignals() noexcept;
+
+    Fd       wake_fd_;
+    Fd       timer_fd_;
+    Fd       signal_fd_;
+    sigset_t signal_mask_;
+#elif defined(SRR_TARGET_APPLE)
+    std::array<struct sigaction, impl::REACTOR_SIGNALS> dispositions_;
+#endif // SRR_TARGET_LINUX
+
+    Fd                                                  poll_fd_;
+    Status                                              status_;
+    ReactorConfig                                       config_;
+    ReactorClock::time_point                            epoch_;
+    TimerWheel                                          wheel_;
+    u64                                                 deadline_;
+    bool                                                armed_;
+
+    std::array<impl::ReactorEvent, impl::REACTOR_BATCH> events_;
+    usize                                               count_;
+    usize                                               cursor_;
+
+    std::array<SignalWatch *, impl::REACTOR_SIGNALS>    signals_;
+    std::atomic<bool>                                   stopped_;
+};
+
+namespace impl {
+
+[[nodiscard]] inline timespec toTimespec(
+    ReactorClock::duration span) noexcept {
+    const std::chrono::seconds seconds =
+        std::chrono::duration_cast<std::chrono::seconds>(span);
+    const std::chrono::nanoseconds rest = span - seconds;
+
+    return {
+        .tv_sec  = static_cast<time_t>(seconds.count()),
+        .tv_nsec = static_cast<long>(rest.count()),
+    };
+}
+
+#if defined(SRR_TARGET_LINUX)
+
+[[nodiscard]] inline u32 epollMask(IoMask interest) noexcept {
+    u32 mask = EPOLLET;
+
+    if ((interest & IO_READ) != 0) mask |= EPOLLIN | EPOLLRDHUP;
+    if ((interest & IO_WRITE) != 0) mask |= EPOLLOUT;
+
+    return mask;
+}
+
+[[nodiscard]] inline IoMask ioMask(u32 events) noexcept {
+    IoMask mask = 0;
+
+    if ((events & EPOLLIN) != 0) mask |= IO_READ;
+    if ((events & EPOLLOUT) != 0) mask |= IO_WRITE;
+    if ((events & (EPOLLHUP | EPOLLRDHUP)) != 0) mask |= IO_HANGUP;
+    if ((events & EPOLLERR) != 0) mask |= IO_ERROR;
+
+    return mask;
+}
+
+// Edge-triggered counters have to be read until empty to rearm.
+inline void drainCounter(Fd fd) noexcept {
+    u64 value = 0;
+    while (::read(fd, &value, sizeof(value)) > 0) {}
+}
+
+#elif defined(SRR_TARGET_APPLE)
+
+[[nodiscard]] inline i32 kqueueChange(Fd     queue,
+                                      usize  ident,
+                                      i16    filter,
+                                      u16    flags,
+                                      u32    fflags,
+                                      i64    data,
+                                      void  *udata) noexcept {
+    struct kevent change {};
+    EV_SET(&change, ident, filter, flags, fflags, data, udata);
+
+    return kevent(queue, &change, 1, nullptr, 0, nullptr);
+}
+
+// Adds the filter when wanted and drops it otherwise, a filter that was
+// never added is not an error.
+[[nodiscard]] inline Status kqueueFilter(Fd       queue,
+                                         IoWatch &watch,
+                                         i16      filter,
+                                         IoMask   wanted) noexcept {
+    const usize ident = static_cast<usize>(watch.fd);
+
+    if ((watch.interest & wanted) != 0) {
+        const i32 added = kqueueChange(
+            queue, ident, filter, EV_ADD | EV_CLEAR, 0, 0, &watch);
+        if (added < 0) return Err::IO_FAILED_TO_WATCH;
+        return {};
+    }
+
+    if (kqueueChange(queue, ident, filter, EV_DELETE, 0, 0, nullptr) < 0 &&
+        errno != ENOENT)
+        return Err::IO_FAILED_TO_WATCH;
+
+    return {};
+}
+
+#endif // SRR_TARGET_LINUX
+
+} // namespace impl
+
+inline ReactorConfig makeReactorConfig() noexcept {
+    return {
+        .tick = impl::REACTOR_DEFAULT_TICK,
+    };
+}
+
+// Reactor ---
+
+inline Reactor::Reactor(ReactorConfig config) noexcept :
+#if defined(SRR_TARGET_LINUX)
+    wake_fd_{ -1 },
+    timer_fd_{ -1 },
+    signal_fd_{ -1 },
+    signal_mask_{},
+#elif defined(SRR_TARGET_APPLE)
+    dispositions_{},
+#endif // SRR_TARGET_LINUX
+    poll_fd_{ -1 },
+    status_{},
+    config_{ config },
+    epoch_{ ReactorClock::now() },
+    wheel_{ 0 },
+    deadline_{ 0 },
+    armed_{ false },
+    events_{},
+    count_{ 0 },
+    cursor_{ 0 },
+    signals_{},
+    stopped_{ false } {
+    if (config_.tick <= ReactorClock::duration::zero())
+        config_.tick = impl::REACTOR_DEFAULT_TICK;
+
+#if defined(SRR_TARGET_LINUX)
+    sigemptyset(&signal_mask_);
+
+    poll_fd_  = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd_  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (poll_fd_ < 0 || wake_fd_ < 0 || timer_fd_ < 0) {
+        status_ = Err::IO_FAILED_TO_OPEN;
+        return;
+    }
+
+    // Internal descriptors are told apart by the address of their member.
+    epoll_event wake{ .events = EPOLLIN | EPOLLET,
+                      .data   = { .ptr = &wake_fd_ } };
+    epoll_event timer{ .events = EPOLLIN | EPOLLET,
+                       .data   = { .ptr = &timer_fd_ } };
+
+    if (epoll_ctl(poll_fd_, EPOLL_CTL_ADD, wake_fd_, &wake) < 0 ||
+        epoll_ctl(poll_fd_, EPOLL_CTL_ADD, timer_fd_, &timer) < 0)
+        status_ = Err::IO_FAILED_TO_OPEN;
+#elif defined(SRR_TARGET_APPLE)
+    poll_fd_ = kqueue();
+
+    if (poll_fd_ < 0 ||
+        impl::kqueueChange(
+            poll_fd_, 0, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, nullptr) < 0)
+        status_ = Err::IO_FAILED_TO_OPEN;
+#endif // SRR_TARGET_LINUX
+}
+
+inline Reactor::~Reactor() noexcept {
+#if defined(SRR_TARGET_LINUX)
+    if (signal_fd_ >= 0) {
+        (void)pthread_sigmask(SIG_UNBLOCK, &signal_mask_, nullptr);
+        (void)close(signal_fd_);
+    }
+    if (timer_fd_ >= 0) (void)close(timer_fd_);
+    if (wake_fd_ >= 0) (void)close(wake_fd_);
+#elif defined(SRR_TARGET_APPLE)
+    for (usize signal = 1; signal < signals_.size(); ++signal) {
+        if (signals_[signal] != nullptr)
+            (void)sigaction(
+                static_cast<i32>(signal), &dispositions_[signal], nullptr);
+    }
+#endif // SRR_TARGET_LINUX
+
+    if (poll_fd_ >= 0) (void)close(poll_fd_);
+}
+
+inline Status Reactor::status() const noexcept { return status_; }
+
+inline Status Reactor::add(IoWatch &watch) noexcept {
+    if (status_.bad()) return status_;
+
+#if defined(SRR_TARGET_LINUX)
+    epoll_event event{
+        .events = impl::epollMask(watch.interest),
+        .data   = { .ptr = &watch },
+    };
+
+    if (epoll_ctl(poll_fd_, EPOLL_CTL_ADD, watch.fd, &event) < 0)
+        return Err::IO_FAILED_TO_WATCH;
+
+    return {};
+#elif defined(SRR_TARGET_APPLE)
+    return modify(watch);
+#endif // SRR_TARGET_LINUX
+}
+
+inline Status Reactor::modify(IoWatch &watch) noexcept {
+    if (status_.bad()) return status_;
+
+#if defined(SRR_TARGET_LINUX)
+    epoll_event event{
+        .events = impl::epollMask(watch.interest),
+        .data   = { .ptr = &watch },
+    };
+
+    if (epoll_ctl(poll_fd_, EPOLL_CTL_MOD, watch.fd, &event) < 0)
+        return Err::IO_FAILED_TO_WATCH;
+
+    return {};
+#elif defined(SRR_TARGET_APPLE)
+    const Status read =
+        impl::kqueueFilter(poll_fd_, watch, EVFILT_READ, IO_READ);
+    if (read.bad()) return read;
+
+    return impl::kqueueFilter(poll_fd_, watch, EVFILT_WRITE, IO_WRITE);
+#endif // SRR_TARGET_LINUX
+}
+
+inline void Reactor::remove(IoWatch &watch) noexcept {
+    if (status_.bad()) return;
+
+#if defined(SRR_TARGET_LINUX)
+    (void)epoll_ctl(poll_fd_, EPOLL_CTL_DEL, watch.fd, nullptr);
+
+    // Events already fetched for the watch must not reach it any more.
+    for (usize i = cursor_; i < count_; ++i) {
+        if (events_[i].data.ptr == &watch) events_[i].data.ptr = nullptr;
+    }
+#elif defined(SRR_TARGET_APPLE)
+    const usize ident = static_cast<usize>(watch.fd);
+
+    (void)impl::kqueueChange(
+        poll_fd_, ident, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
+    (void)impl::kqueueChange(
+        poll_fd_, ident, EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+
+    for (usize i = cursor_; i < count_; ++i) {
+        if (events_[i].udata == &watch) events_[i].udata = nullptr;
+    }
+#endif // SRR_TARGET_LINUX
+}
+
+inline Status Reactor::watchSignals(std::span<const i32> signals,
+                                    SignalWatch         &watch) noexcept {
+    if (status_.bad()) return status_;
+
+    for (const i32 signal : signals) {
+        if (signal <= 0 || static_cast<usize>(signal) >= signals_.size())
+            return Err::IO_FAILED_TO_WATCH;
+    }
+
+#if defined(SRR_TARGET_LINUX)
+    sigset_t mask = signal_mask_;
+    for (const i32 signal : signals) sigaddset(&mask, signal);
+
+    if (pthread_sigmask(SIG_BLOCK, &mask, nullptr) != 0)
+        return Err::IO_FAILED_TO_WATCH;
+
+    // Passing the existing descriptor updates its mask in place.
+    const Fd fd = signalfd(signal_fd_, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (fd < 0) return Err::IO_FAILED_TO_WATCH;
+
+    if (signal_fd_ < 0) {
+        epoll_event event{ .events = EPOLLIN | EPOLLET,
+                           .data   = { .ptr = &signal_fd_ } };
+
+        if (epoll_ctl(poll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+            (void)close(fd);
+            return Err::IO_FAILED_TO_WATCH;
+        }
+    }
+
+    signal_fd_   = fd;
+    signal_mask_ = mask;
+#elif defined(SRR_TARGET_APPLE)
+    // kqueue only observes signals, the previous action is kept aside and
+    // replaced by SIG_IGN while the signal is watched.
+    for (const i32 signal : signals) {
+        const usize index = static_cast<usize>(signal);
+        if (signals_[index] != nullptr) continue;
+
+        struct sigaction ignore {};
+        ignore.sa_handler = SIG_IGN;
+        sigemptyset(&ignore.sa_mask);
+
+        if (sigaction(signal, &ignore, &dispositions_[index]) < 0)
+            return Err::IO_FAILED_TO_WATCH;
+
+        if (impl::kqueueChange(poll_fd_,
+                               index,
+                               EVFILT_SIGNAL,
+                               EV_ADD,
+                               0,
+                               0,
+                               nullptr) < 0) {
+            (void)sigaction(signal, &dispositions_[index], nullptr);
+            return Err::IO_FAILED_TO_WATCH;
+        }
+
+        signals_[index] = &watch;
+    }
+#endif // SRR_TARGET_LINUX
+
+    for (const i32 signal : signals)
+        signals_[static_cast<usize>(signal)] = &watch;
+
+    return {};
+}
+
+inline void Reactor::schedule(Timer                 &timer,
+                              ReactorClock::duration delay) noexcept {
+    const i64 step  = config_.tick.count();
+    const i64 count = delay.count();
+    const u64 ticks =
+        count <= 0 ? 0 : static_cast<u64>((count + step - 1) / step);
+
+    // The wheel only moves when polled, count from where it stands.
+    wheel_.schedule(timer, tick() - wheel_.now() + ticks);
+
+    if (!armed_ || timer.expiry() < deadline_) arm(timer.expiry());
+}
+
+inline void Reactor::cancel(Timer &timer) noexcept { wheel_.cancel(timer); }
+
+inline Result<usize> Reactor::poll(i32 timeout) noexcept {
+    if (status_.bad()) return status_.err();
+
+#if defined(SRR_TARGET_LINUX)
+    const i32 ready = epoll_wait(poll_fd_,
+                                 events_.data(),
+                                 static_cast<i32>(events_.size()),
+                                 timeout);
+#elif defined(SRR_TARGET_APPLE)
+    const timespec limit =
+        impl::toTimespec(std::chrono::milliseconds{ timeout });
+
+    const i32 ready = kevent(poll_fd_,
+                             nullptr,
+                             0,
+                             events_.data(),
+                             static_cast<i32>(events_.size()),
+                             timeout < 0 ? nullptr : &limit);
+#endif // SRR_TARGET_LINUX
+
+    if (ready < 0 && errno != EINTR) return Err::IO_FAILED_TO_WAIT;
+
+    usize handled = 0;
+
+    count_        = ready < 0 ? 0 : static_cast<usize>(ready);
+    for (cursor_ = 0; cursor_ < count_; ++cursor_)
+        handled += dispatch(events_[cursor_]);
+
+    count_  = 0;
+    cursor_ = 0;
+
+    return handled + expire();
+}
+
+inline Status Reactor::run() noexcept {
+    while (!stopped_.load(std::memory_order_relaxed)) {
+        const Result<usize> handled = poll(POLL_FOREVER);
+        if (handled.bad()) return handled.err();
+    }
+
+    stopped_.store(false, std::memory_order_relaxed);
+    return {};
+}
+
+inline void Reactor::stop() noexcept {
+    stopped_.store(true, std::memory_order_relaxed);
+    wake();
+}
+
+inline void Reactor::wake() noexcept {
+#if defined(SRR_TARGET_LINUX)
+    const u64 one = 1;
+    (void)::write(wake_fd_, &one, sizeof(one));
+#elif defined(SRR_TARGET_APPLE)
+    (void)impl::kqueueChange(
+        poll_fd_, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr);
+#endif // SRR_TARGET_LINUX
+}
+
+inline u64 Reactor::tick() const noexcept {
+    return static_cast<u64>((ReactorClock::now() - epoch_) / config_.tick);
+}
+
+inline usize Reactor::dispatch(impl::ReactorEvent &event) noexcept {
+#if defined(SRR_TARGET_LINUX)
+    void *const target = event.data.ptr;
+
+    if (target == nullptr) return 0;
+
+    if (target == &wake_fd_ || target == &timer_fd_) {
+        impl::drainCounter(target == &wake_fd_ ? wake_fd_ : timer_fd_);
+        return 0;
+    }
+
+    if (target == &signal_fd_) return drainSignals();
+
+    IoWatch &watch = *static_cast<IoWatch *>(target);
+    watch.callback(watch, impl::ioMask(event.events));
+
+    return 1;
+#elif defined(SRR_TARGET_APPLE)
+    switch (event.filter) {
+    case EVFILT_USER :
+    case EVFILT_TIMER: return 0;
+    case EVFILT_SIGNAL: {
+        SignalWatch *watch = signals_[static_cast<usize>(event.ident)];
+        if (watch == nullptr) return 0;
+
+        watch->callback(*watch, static_cast<i32>(event.ident));
+        return 1;
+    }
+    default: break;
+    }
+
+    if (event.udata == nullptr) return 0;
+
+    IoMask events = event.filter == EVFILT_READ ? IO_READ : IO_WRITE;
+    if ((event.flags & EV_EOF) != 0) events |= IO_HANGUP;
+    if ((event.flags & EV_ERROR) != 0) events |= IO_ERROR;
+
+    IoWatch &watch = *static_cast<IoWatch *>(event.udata);
+    watch.callback(watch, events);
+
+    return 1;
+#endif // SRR_TARGET_LINUX
+}
+
+inline usize Reactor::expire() noexcept {
+    if (wheel_.empty()) {
+        disarm();
+        return 0;
+    }
+
+    const usize fired = wheel_.advance(tick());
+    if (wheel_.empty()) {
+        disarm();
+        return fired;
+    }
+
+    // A spent or stale deadline is moved to the wheel's next expiry.
+    const u64 next = wheel_.next();
+    if (!armed_ || next != deadline_ || deadline_ <= wheel_.now()) arm(next);
+
+    return fired;
+}
+
+inline void Reactor::arm(u64 deadline) noexcept {
+    const ReactorClock::duration left =
+        epoch_ + (config_.tick * static_cast<i64>(deadline)) -
+        ReactorClock::now();
+
+    // A zero delay would disarm the timer rather than fire it.
+    const std::chrono::nanoseconds delay =
+        left > ReactorClock::duration::zero() ? std::chrono::nanoseconds{ left }
+                                              : std::chrono::nanoseconds{ 1 };
+
+#if defined(SRR_TARGET_LINUX)
+    const itimerspec spec{ .it_interval = {},
+                           .it_value    = impl::toTimespec(delay) };
+
+    armed_ = timerfd_settime(timer_fd_, 0, &spec, nullptr) == 0;
+#elif defined(SRR_TARGET_APPLE)
+    armed_ = impl::kqueueChange(poll_fd_,
+                                0,
+                                EVFILT_TIMER,
+                                EV_ADD | EV_ENABLE | EV_ONESHOT,
+                                NOTE_NSECONDS,
+                                static_cast<i64>(delay.count()),
+                                nullptr) == 0;
+#endif // SRR_TARGET_LINUX
+
+    deadline_ = deadline;
+}
+
+inline void Reactor::disarm() noexcept {
+    if (!armed_) return;
+
+#if defined(SRR_TARGET_LINUX)
+    const itimerspec spec{};
+    (void)timerfd_settime(timer_fd_, 0, &spec, nullptr);
+#elif defined(SRR_TARGET_APPLE)
+    (void)impl::kqueueChange(
+        poll_fd_, 0, EVFILT_TIMER, EV_DELETE, 0, 0, nullptr);
+#endif // SRR_TARGET_LINUX
+
+    armed_ = false;
+}
+
+#if defined(SRR_TARGET_LINUX)
+
+inline usize Reactor::drainSignals() noexcept {
+    usize            handled = 0;
+    signalfd_siginfo info{};
+
+    while (::read(signal_fd_, &info, sizeof(info)) ==
+           static_cast<ssize_t>(sizeof(info))) {
+        SignalWatch *watch = signals_[info.ssi_signo];
+        if (watch == nullptr) continue;
+
+        watch->callback(*watch, static_cast<i32>(info.ssi_signo));
+        ++handled;
+    }
+
+    return handled;
+}
+
+#endif // SRR_TARGET_LINUX
+
+} // namespace io
+} // namespace srr
+
+#endif // SRR_IO_REACTOR_HPP
@@ -0,0 +1,383 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_IO_TIMER_HPP
+#define SRR_IO_TIMER_HPP
+
+#include "sierra/prims.hpp"
+
+#include <array>
+
+inline namespace srr {
+namespace io {
+
+class Timer;
+class TimerWheel;
+
+using TimerCallback = void (*)(Timer &timer) noexcept;
+
+namespace impl {
+
+constexpr usize TIMER_LEVEL_BITS = 8;
+constexpr usize TIMER_LEVELS     = 4;
+constexpr usize TIMER_SLOTS      = usize{ 1 } << TIMER_LEVEL_BITS;
+constexpr u64   TIMER_MASK       = TIMER_SLOTS - 1;
+
+// Level of a timer taken off the wheel by advance() whose callback has not
+// run yet. It sits in the expired batch rather than in a slot, so no level
+// counts it.
+constexpr usize TIMER_BATCH      = TIMER_LEVELS;
+
+// Furthest a timer can be placed, later ones are parked at the horizon and
+// placed again when their slot cascades.
+constexpr u64   TIMER_HORIZON =
+    (u64{ 1 } << (TIMER_LEVEL_BITS * TIMER_LEVELS)) - 1;
+
+// Circular list link, wheel slots hold a bare link as their head.
+struct TimerLink {
+    TimerLink *next;
+    TimerLink *prev;
+};
+
+} // namespace impl
+
+// Intrusive timer node, the owner embeds it and the wheel links it into a
+// slot, so scheduling never allocates. A timer cancels itself when it is
+// destroyed.
+class Timer : private impl::TimerLink {
+public:
+    [[nodiscard]] Timer(TimerCallback callback, void *user) noexcept;
+
+    Timer(const Timer &timer)            = delete;
+    Timer(Timer &&timer)                 = delete;
+    Timer &operator=(const Timer &timer) = delete;
+    Timer &operator=(Timer &&timer)      = delete;
+
+    ~Timer() noexcept;
+
+    [[nodiscard]] bool  scheduled() const noexcept;
+    [[nodiscard]] u64   expiry() const noexcept;
+    [[nodiscard]] void *user() const noexcept;
+
+private:
+    friend class TimerWheel;
+
+    TimerWheel   *wheel_;
+    u64           expiry_;
+    usize         level_;
+    TimerCallback callback_;
+    void         *user_;
+};
+
+// Hierarchical hashed timer wheel over abstract ticks. Level 0 has one slot
+// per tick, each level above covers a whole revolution of the one below per
+// slot. A timer goes to the lowest level that reaches its expiry and moves
+// down a level each time the slot it sits in comes round, so schedule and
+// cancel are O(1) and a timer is touched at most once per level.
+//
+// The wheel is driven by advance(), from a Reactor or by hand. Ticks with no
+// timers at the lower levels are skipped, and everything that expires during
+// one call is collected as a batch before any callback runs, so callbacks
+// may schedule or cancel any timer including their own.
+class TimerWheel {
+public:
+    [[nodiscard]] explicit TimerWheel(u64 now) noexcept;
+
+    TimerWheel(const TimerWheel &wheel)            = delete;
+    TimerWheel(TimerWheel &&wheel)                 = delete;
+    TimerWheel &operator=(const TimerWheel &wheel) = delete;
+    TimerWheel &operator=(TimerWheel &&wheel)      = delete;
+
+    ~TimerWheel() noexcept;
+
+    [[nodiscard]] u64   now() const noexcept;
+    [[nodiscard]] usize size() const noexcept;
+    [[nodiscard]] bool  empty() const noexcept;
+
+    // Earliest tick at which advance() can fire a timer or has to move one
+    // down a level, U64_MAX when the wheel is empty. Driving the wheel at
+    // these ticks is enough to fire every timer on time.
+    [[nodiscard]] u64   next() const noexcept;
+
+    // Fires delay ticks after now(), at the earliest on the next tick.
+    // Scheduling a scheduled timer moves it.
+    void                schedule(Timer &timer, u64 delay) noexcept;
+    void                cancel(Timer &timer) noexcept;
+
+    // Moves the wheel to now and fires every timer that expired on the
+    // way, returns how many fired.
+    usize               advance(u64 now) noexcept;
+
+private:
+    using Level = std::array<impl::TimerLink, impl::TIMER_SLOTS>;
+
+    static void link(impl::TimerLink &head, impl::TimerLink &node) noexcept;
+    static void unlink(impl::TimerLink &node) noexcept;
+    static void splice(impl::TimerLink &head, impl::TimerLink &list) noexcept;
+
+    void        place(Timer &timer) noexcept;
+    void        cascade() noexcept;
+    void        skip(u64 now) noexcept;
+
+    std::array<Level, impl::TIMER_LEVELS> levels_;
+    std::array<usize, impl::TIMER_LEVELS> counts_;
+    u64                                   now_;
+    usize                                 size_;
+};
+
+// Timer ---
+
+inline Timer::Timer(TimerCallback callback, void *user) noexcept :
+    impl::TimerLink{ .next = nullptr, .prev = nullptr },
+    wheel_{ nullptr },
+    expiry_{ 0 },
+    level_{ 0 },
+    callback_{ callback },
+    user_{ user } {}
+
+inline Timer::~Timer() noexcept {
+    if (wheel_ != nullptr) wheel_->cancel(*this);
+}
+
+inline bool  Timer::scheduled() const noexcept { return wheel_ != nullptr; }
+
+inline u64   Timer::expiry() const noexcept { return expiry_; }
+
+inline void *Timer::user() const noexcept { return user_; }
+
+// TimerWheel ---
+
+inline TimerWheel::TimerWheel(u64 now) noexcept :
+    levels_{},
+    counts_{},
+    now_{ now },
+    size_{ 0 } {
+    for (Level &level : levels_) {
+        for (impl::TimerLink &slot : level) {
+            slot.next = &slot;
+            slot.prev = &slot;
+        }
+    }
+}
+
+inline TimerWheel::~TimerWheel() noexcept {
+    for (Level &level : levels_) {
+        for (impl::TimerLink &slot : level) {
+            while (slot.next != &slot) {
+                Timer &timer = static_cast<Timer &>(*slot.next);
+                unlink(timer);
+                timer.wheel_ = nullptr;
+            }
+        }
+    }
+}
+
+inline u64   TimerWheel::now() const noexcept { return now_; }
+
+inline usize TimerWheel::size() const noexcept { return size_; }
+
+inline bool  TimerWheel::empty() const noexcept { return size_ == 0; }
+
+inline u64   TimerWheel::next() const noexcept {
+    // Higher levels only move down when the levels below them wrap.
+    u64 next = U64_MAX;
+    for (usize level = 1; level < impl::TIMER_LEVELS; ++level) {
+        if (counts_[level] == 0) continue;
+
+        const usize bits = impl::TIMER_LEVEL_BITS * level;
+        next             = (now_ | ((u64{ 1 } << bits) - 1)) + 1;
+        break;
+    }
+
+    if (counts_[0] == 0) return next;
+
+    for (u64 tick = now_ + 1; tick < next && tick <= now_ + impl::TIMER_SLOTS;
+         ++tick) {
+        const impl::TimerLink &slot = levels_[0][tick & impl::TIMER_MASK];
+        if (slot.next != &slot) return tick;
+    }
+
+    return next;
+}
+
+inline void  TimerWheel::schedule(Timer &timer, u64 delay) noexcept {
+    if (timer.wheel_ != nullptr) timer.wheel_->cancel(timer);
+
+    timer.wheel_  = this;
+    timer.expiry_ = now_ + (delay == 0 ? 1 : delay);
+
+    place(timer);
+    ++size_;
+}
+
+inline void TimerWheel::cancel(Timer &timer) noexcept {
+    if (timer.wheel_ != this) return;
+
+    unlink(timer);
+    timer.wheel_ = nullptr;
+    if (timer.level_ != impl::TIMER_BATCH) --counts_[timer.level_];
+    --size_;
+}
+
+inline usize TimerWheel::advance(u64 now) noexcept {
+    impl::TimerLink expired{ .next = nullptr, .prev = nullptr };
+    expired.next = &expired;
+    expired.prev = &expired;
+
+    while (now_ < now) {
+        skip(now);
+        if (now_ == now) break;
+
+        ++now_;
+        if ((now_ & impl::TIMER_MASK) == 0) cascade();
+
+        // Level 0 holds exactly one tick per slot, the whole slot is due.
+        impl::TimerLink &slot = levels_[0][now_ & impl::TIMER_MASK];
+        while (slot.next != &slot) {
+            Timer &timer = static_cast<Timer &>(*slot.next);
+            unlink(timer);
+            link(expired, timer);
+            timer.level_ = impl::TIMER_BATCH;
+            --counts_[0];
+        }
+    }
+
+    usize fired = 0;
+    while (expired.next != &expired) {
+        Timer &timer = static_cast<Timer &>(*expired.next);
+        unlink(timer);
+
+        timer.wheel_ = nullptr;
+        --size_;
+        ++fired;
+
+        timer.callback_(timer);
+    }
+
+    return fired;
+}
+
+inline void TimerWheel::link(impl::TimerLink &head,
+                             impl::TimerLink &node) noexcept {
+    node.next       = &head;
+    node.prev       = head.prev;
+    head.prev->next = &node;
+    head.prev       = &node;
+}
+
+inline void TimerWheel::unlink(impl::TimerLink &node) noexcept {
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.next       = nullptr;
+    node.prev       = nullptr;
+}
+
+inline void TimerWheel::place(Timer &timer) noexcept {
+    const u64 delta  = timer.expiry_ > now_ ? timer.expiry_ - now_ : 0;
+    const u64 target = delta > impl::TIMER_HORIZON
+                           ? now_ + impl::TIMER_HORIZON
+                           : now_ + delta;
+
+    usize     level  = 0;
+    while (level + 1 < impl::TIMER_LEVELS &&
+           (delta >> (impl::TIMER_LEVEL_BITS * (level + 1))) != 0)
+        ++level;
+
+    const u64 slot = (target >> (impl::TIMER_LEVEL_BITS * level)) &
+                     impl::TIMER_MASK;
+
+    link(levels_[level][slot], timer);
+    timer.level_ = level;
+    ++counts_[level];
+}
+
+// Called as level 0 wraps, moves the timers in the current slot of every
+// level that wrapped along with it down to the levels below.
+inline void TimerWheel::cascade() noexcept {
+    usize top = 1;
+    while (top + 1 < impl::TIMER_LEVELS &&
+           ((now_ >> (impl::TIMER_LEVEL_BITS * top)) & impl::TIMER_MASK) == 0)
+        ++top;
+
+    for (usize level = top; level > 0; --level) {
+        const u64 slot = (now_ >> (impl::TIMER_LEVEL_BITS * level)) &
+                         impl::TIMER_MASK;
+
+        impl::TimerLink pending{ .next = nullptr, .prev = nullptr };
+        pending.next = &pending;
+        pending.prev = &pending;
+
+        splice(pending, levels_[level][slot]);
+        while (pending.next != &pending) {
+            Timer &timer = static_cast<Timer &>(*pending.next);
+            unlink(timer);
+            --counts_[level];
+
+            place(timer);
+        }
+    }
+}
+
+// Jumps over ticks that cannot fire or cascade anything, up to the last
+// tick before the next wrap of the lowest occupied level.
+inline void TimerWheel::skip(u64 now) noexcept {
+    usize bits = 0;
+    for (usize level = 0; level < impl::TIMER_LEVELS; ++level) {
+        if (counts_[level] != 0) break;
+        bits += impl::TIMER_LEVEL_BITS;
+    }
+
+    if (bits == 0) return;
+
+    if (bits == impl::TIMER_LEVEL_BITS * impl::TIMER_LEVELS) {
+        now_ = now;
+        return;
+    }
+
+    const u64 last = now_ | ((u64{ 1 } << bits) - 1);
+    now_           = last < now ? last : now;
+}
+
+inline void TimerWheel::splice(impl::TimerLink &head,
+                               impl::TimerLink &list) noexcept {
+    if (list.next == &list) return;
+
+    list.next->prev = head.prev;
+    list.prev->next = &head;
+    head.prev->next = list.next;
+    head.prev       = list.prev;
+
+    list.next       = &list;
+    list.prev       = &list;
+}
+
+} // namespace io
+} // namespace srr
+
+#endif // SRR_IO_TIMER_HPP
@@ -0,0 +1,1005 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_BINARY_HPP
+#define SRR_JSON_BINARY_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/json/index.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/json/writer.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+inline namespace srr {
+namespace json {
+
+class BinaryIter;
+class BinaryMemberIter;
+class BinaryValue;
+
+struct BinaryMember;
+
+namespace impl {
+
+// Every value starts with a tag byte, the kind in the high bits and the
+// width of its header fields in the low two, 1 << code bytes. Scalars
+// follow with their little-endian payload, strings with their length and
+// bytes, containers with their child count, body size and body. Object
+// bodies alternate string keys and values.
+enum class BinaryKind : u8 {
+    NUL = 0,
+    BOOL_FALSE,
+    BOOL_TRUE,
+    INT,
+    UINT,
+    FLOAT,
+    STRING,
+    ARRAY,
+    OBJECT,
+};
+
+constexpr std::string_view BINARY_MAGIC        = "SJB1";
+constexpr u32              BINARY_WIDTH_BITS   = 2;
+constexpr u8               BINARY_WIDTH_MASK   = 0x03;
+constexpr u32              BYTE_BITS           = 8;
+
+// Containers are opened with four byte fields and patched once their body
+// is done, small ones are narrowed then. The reader takes any width.
+constexpr usize            BINARY_FIELD_WIDTH  = sizeof(u32);
+constexpr u8               BINARY_FIELD_CODE   = 2;
+constexpr usize            BINARY_FRAME_HEADER = 1 + (2 * BINARY_FIELD_WIDTH);
+constexpr usize            BINARY_MAX_SCALAR   = 1 + sizeof(u64);
+constexpr u8               BINARY_FLOAT_CODE   = 3;
+
+struct BinaryHeader {
+    BinaryKind kind;
+
+    // Bytes before the string bytes or the container body.
+    usize      head;
+
+    // Number bits, string length or container count.
+    u64        payload;
+
+    // Container body size.
+    u64        body;
+};
+
+// Lookups behind find(), at() and readBinary(), which cannot be friends
+// themselves as their Result<BinaryValue> needs the complete type.
+struct BinaryAccess;
+
+[[nodiscard]] inline u64   readLittle(const char *src, usize width) noexcept;
+inline void                writeLittle(char *dst,
+                                       u64   value,
+                                       usize width) noexcept;
+
+// Code of the narrowest field holding value.
+[[nodiscard]] constexpr u8 widthCode(u64 value) noexcept;
+[[nodiscard]] constexpr u8 signedWidthCode(i64 value) noexcept;
+[[nodiscard]] constexpr u8 binaryTag(BinaryKind kind, u8 code) noexcept;
+
+// Fails with JSON_BAD_TOKEN when the value at ptr is malformed or does not
+// fit before end.
+[[nodiscard]] inline Result<BinaryHeader> readHeader(const char *ptr,
+                                                     const char *end) noexcept;
+
+// Bytes of the value at ptr, zero when it is malformed.
+[[nodiscard]] inline usize binaryExtent(const char *ptr,
+                                        const char *end) noexcept;
+
+} // namespace impl
+
+// Handle to one value of a binary document, a position in the caller's
+// buffer. Nothing is decoded ahead, every header is bounds checked when it
+// is read, and strings are views into the buffer. Trivially copyable, valid
+// as long as the buffer.
+class BinaryValue {
+public:
+    // NUL for malformed values, the getters report them.
+    [[nodiscard]] Type                     type() const noexcept;
+
+    // Fail with JSON_BAD_CAST when the value is of another type,
+    // JSON_BAD_SUBTYPE when a number does not fit the requested one and
+    // JSON_BAD_TOKEN when the value is malformed.
+    [[nodiscard]] Result<bool>             getBool() const noexcept;
+    [[nodiscard]] Result<i64>              getI64() const noexcept;
+    [[nodiscard]] Result<u64>              getU64() const noexcept;
+    [[nodiscard]] Result<f64>              getF64() const noexcept;
+    [[nodiscard]] Result<Number>           getNumber() const noexcept;
+    [[nodiscard]] Result<std::string_view> getString() const noexcept;
+
+    // Stored in the header, zero for scalars.
+    [[nodiscard]] usize                    size() const noexcept;
+
+    // Both ranges are empty for values of another type and end early at the
+    // first malformed child.
+    [[nodiscard]] BinaryIter               begin() const noexcept;
+    [[nodiscard]] BinaryIter               end() const noexcept;
+    [[nodiscard]] BinaryMemberIter         membersBegin() const noexcept;
+    [[nodiscard]] BinaryMemberIter         membersEnd() const noexcept;
+
+private:
+    friend class BinaryIter;
+    friend class BinaryMemberIter;
+    friend struct impl::BinaryAccess;
+
+    [[nodiscard]] BinaryValue(const char *ptr, const char *end) noexcept;
+
+    // Body bounds of a container of kind, empty for anything else.
+    [[nodiscard]] std::span<const char> body(
+        impl::BinaryKind kind) const noexcept;
+
+    const char *ptr_;
+    const char *end_;
+};
+
+struct BinaryMember {
+    std::string_view key;
+    BinaryValue      value;
+};
+
+// Checks the magic and that the root value spans the rest of data, which
+// must outlive every value read from it. Fails with JSON_BAD_TOKEN for a
+// missing magic or malformed root, JSON_SYNTAX_EXP_VALUE when there is no
+// root and JSON_SYNTAX_DBL_ROOT when bytes follow it.
+[[nodiscard]] inline Result<BinaryValue> readBinary(
+    std::span<const char> data) noexcept;
+
+// Object member by key, stepping over the members before it in constant
+// time each. Fails with JSON_BAD_CAST when object is not one, NO_SUCH_KEY,
+// and JSON_BAD_TOKEN for malformed members on the way.
+[[nodiscard]] inline Result<BinaryValue> find(const BinaryValue &object,
+                                              std::string_view   key) noexcept;
+
+// Array element by position. Fails with JSON_BAD_CAST when array is not
+// one, INDEX_OUT_OF_RANGE, and JSON_BAD_TOKEN for malformed elements on the
+// way.
+[[nodiscard]] inline Result<BinaryValue> at(const BinaryValue &array,
+                                            usize              index) noexcept;
+
+// Serializes a whole value.
+template<ValueWriter W>
+[[nodiscard]] Status write(W &writer, const BinaryValue &value) noexcept;
+
+class BinaryIter {
+public:
+    [[nodiscard]] BinaryValue operator*() const noexcept;
+    BinaryIter               &operator++() noexcept;
+    [[nodiscard]] bool        operator==(const BinaryIter &rhs) const noexcept;
+
+private:
+    friend class BinaryValue;
+
+    [[nodiscard]] BinaryIter(const char *ptr, const char *end) noexcept;
+
+    const char *ptr_;
+    const char *end_;
+};
+
+class BinaryMemberIter {
+public:
+    [[nodiscard]] BinaryMember operator*() const noexcept;
+    BinaryMemberIter          &operator++() noexcept;
+    [[nodiscard]] bool operator==(const BinaryMemberIter &rhs) const noexcept;
+
+private:
+    friend class BinaryValue;
+
+    [[nodiscard]] BinaryMemberIter(const char *ptr, const char *end) noexcept;
+
+    // Bytes of the key and value at ptr, zero unless both are well formed.
+    [[nodiscard]] static usize extent(const char *ptr,
+                                      const char *end) noexcept;
+
+    const char *ptr_;
+    const char *end_;
+};
+
+// Encoder for the binary format behind readBinary(), driven through the
+// same calls as Writer and appending to a growable buffer that starts with
+// the magic. Numbers keep their NumberType and take the narrowest field
+// that holds them, strings are copied as is. Bodies of a single container
+// are limited to U32_MAX bytes.
+//
+// Misuse fails with the JSON_SYNTAX_* codes or JSON_BAD_TOKEN for a stray
+// close, nesting past JSON_MAX_DEPTH and oversized containers with
+// CAPACITY_EXCEEDED. The first error sticks until clear(). Not thread-safe.
+class BinaryWriter {
+public:
+    [[nodiscard]] BinaryWriter() noexcept;
+
+    BinaryWriter(const BinaryWriter &writer)            = delete;
+    BinaryWriter(BinaryWriter &&writer)                 = delete;
+    BinaryWriter &operator=(const BinaryWriter &writer) = delete;
+    BinaryWriter &operator=(BinaryWriter &&writer)      = delete;
+
+    ~BinaryWriter() noexcept                            = default;
+
+    [[nodiscard]] Status           status() const noexcept;
+
+    // Magic and values written so far.
+    [[nodiscard]] std::string_view view() const noexcept;
+
+    // Drops the output, the error and any open containers.
+    void                           clear() noexcept;
+
+    [[nodiscard]] Status           beginObject() noexcept;
+    [[nodiscard]] Status           endObject() noexcept;
+    [[nodiscard]] Status           beginArray() noexcept;
+    [[nodiscard]] Status           endArray() noexcept;
+
+    [[nodiscard]] Status           key(std::string_view key) noexcept;
+    [[nodiscard]] Status           string(std::string_view text) noexcept;
+    [[nodiscard]] Status           number(Number number) noexcept;
+    [[nodiscard]] Status           boolean(bool value) noexcept;
+    [[nodiscard]] Status           null() noexcept;
+
+    template<NumberValue T>
+    [[nodiscard]] Status number(T value) noexcept;
+
+private:
+    enum class Expect : u8 {
+        ROOT = 0,
+        VALUE,
+        KEY,
+        MEMBER,
+        DONE,
+    };
+
+    struct Frame {
+        usize  header;
+        u64    count;
+        Expect inner;
+    };
+
+    [[nodiscard]] Status prefix() noexcept;
+    [[nodiscard]] Status open(impl::BinaryKind kind, Expect inner) noexcept;
+    [[nodiscard]] Status close(Expect inner) noexcept;
+
+    // Moves past a finished value.
+    void                 advance() noexcept;
+
+    [[nodiscard]] Status reserve(usize count) noexcept;
+    [[nodiscard]] Status chars(std::string_view text) noexcept;
+    void                 scalar(impl::BinaryKind kind,
+                                u8               code,
+                                u64              bits) noexcept;
+    [[nodiscard]] Err    fail(Err err) noexcept;
+
+    impl::JsonBuffer<char>  buffer_;
+    impl::JsonBuffer<Frame> frames_;
+    usize                   size_;
+    usize                   depth_;
+    Status                  status_;
+    Expect                  expect_;
+};
+
+namespace impl {
+
+struct BinaryAccess {
+    [[nodiscard]] static Result<BinaryValue> root(
+        std::span<const char> data) noexcept;
+    [[nodiscard]] static Result<BinaryValue> find(
+        const BinaryValue &object,
+        std::string_view   key) noexcept;
+    [[nodiscard]] static Result<BinaryValue> at(
+        const BinaryValue &array,
+        usize              index) noexcept;
+};
+
+inline u64 readLittle(const char *src, usize width) noexcept {
+    u64 value = 0;
+    for (usize i = 0; i < width; ++i)
+        value |= u64{ static_cast<u8>(src[i]) } << (i * BYTE_BITS);
+    return value;
+}
+
+inline void writeLittle(char *dst, u64 value, usize width) noexcept {
+    for (usize i = 0; i < width; ++i)
+        dst[i] = static_cast<char>(static_cast<u8>(value >> (i * BYTE_BITS)));
+}
+
+constexpr u8 widthCode(u64 value) noexcept {
+    if (value <= U8_MAX) return 0;
+    if (value <= U16_MAX) return 1;
+    if (value <= U32_MAX) return 2;
+    return 3;
+}
+
+constexpr u8 signedWidthCode(i64 value) noexcept {
+    if (value >= I8_MIN && value <= I8_MAX) return 0;
+    if (value >= I16_MIN && value <= I16_MAX) return 1;
+    if (value >= I32_MIN && value <= I32_MAX) return 2;
+    return 3;
+}
+
+constexpr u8 binaryTag(BinaryKind kind, u8 code) noexcept {
+    return static_cast<u8>(static_cast<u8>(kind) << BINARY_WIDTH_BITS) | code;
+}
+
+inline Result<BinaryHeader> readHeader(const char *ptr,
+                                       const char *end) noexcept {
+    if (ptr >= end) return Err::JSON_BAD_TOKEN;
+
+    const u8    tag   = static_cast<u8>(*ptr);
+    const u8    code  = tag & BINARY_WIDTH_MASK;
+    const usize width = usize{ 1 } << code;
+    const usize avail = static_cast<usize>(end - ptr) - 1;
+
+    if ((tag >> BINARY_WIDTH_BITS) > static_cast<u8>(BinaryKind::OBJECT))
+        return Err::JSON_BAD_TOKEN;
+
+    BinaryHeader header{
+        .kind    = static_cast<BinaryKind>(tag >> BINARY_WIDTH_BITS),
+        .head    = 1,
+        .payload = 0,
+        .body    = 0,
+    };
+
+    switch (header.kind) {
+    case BinaryKind::NUL  : [[fallthrough]];
+    case BinaryKind::BOOL_FALSE: [[fallthrough]];
+    case BinaryKind::BOOL_TRUE :
+        if (code != 0) return Err::JSON_BAD_TOKEN;
+        break;
+    case BinaryKind::INT  : [[fallthrough]];
+    case BinaryKind::UINT : [[fallthrough]];
+    case BinaryKind::FLOAT:
+        if (width > avail) return Err::JSON_BAD_TOKEN;
+        if (header.kind == BinaryKind::FLOAT && width != sizeof(f64))
+            return Err::JSON_BAD_TOKEN;
+
+        header.head    += width;
+        header.payload  = readLittle(ptr + 1, width);
+
+        // Sign-extend narrow integers.
+        if (header.kind == BinaryKind::INT && width < sizeof(i64)) {
+            const usize shift = (sizeof(i64) - width) * BYTE_BITS;
+            header.payload  = std::bit_cast<u64>(
+                std::bit_cast<i64>(header.payload << shift) >> shift);
+        }
+        break;
+    case BinaryKind::STRING:
+        if (width > avail) return Err::JSON_BAD_TOKEN;
+
+        header.head    += width;
+        header.payload  = readLittle(ptr + 1, width);
+        if (header.payload > avail - width) return Err::JSON_BAD_TOKEN;
+        break;
+    case BinaryKind::ARRAY : [[fallthrough]];
+    case BinaryKind::OBJECT:
+        if (2 * width > avail) return Err::JSON_BAD_TOKEN;
+
+        header.head    += 2 * width;
+        header.payload  = readLittle(ptr + 1, width);
+        header.body     = readLittle(ptr + 1 + width, width);
+        if (header.body > avail - (2 * width)) return Err::JSON_BAD_TOKEN;
+        break;
+    }
+
+    return header;
+}
+
+inline usize binaryExtent(const char *ptr, const char *end) noexcept {
+    const Result<BinaryHeader> header = readHeader(ptr, end);
+    if (header.bad()) return 0;
+
+    switch (header.val().kind) {
+    case BinaryKind::STRING:
+        return header.val().head + static_cast<usize>(header.val().payload);
+    case BinaryKind::ARRAY : [[fallthrough]];
+    case BinaryKind::OBJECT:
+        return header.val().head + static_cast<usize>(header.val().body);
+    default: return header.val().head;
+    }
+}
+
+} // namespace impl
+
+// BinaryValue ---
+
+inline BinaryValue::BinaryValue(const char *ptr, const char *end) noexcept :
+    ptr_{ ptr },
+    end_{ end } {}
+
+inline Type BinaryValue::type() const noexcept {
+    if (ptr_ >= end_) return Type::NUL;
+
+    switch (static_cast<impl::BinaryKind>(static_cast<u8>(*ptr_) >>
+                                          impl::BINARY_WIDTH_BITS)) {
+    case impl::BinaryKind::BOOL_FALSE : [[fallthrough]];
+    case impl::BinaryKind::BOOL_TRUE  : return Type::BOOL;
+    case impl::BinaryKind::INT   : [[fallthrough]];
+    case impl::BinaryKind::UINT  : [[fallthrough]];
+    case impl::BinaryKind::FLOAT : return Type::NUMBER;
+    case impl::BinaryKind::STRING: return Type::STRING;
+    case impl::BinaryKind::ARRAY : return Type::ARRAY;
+    case impl::BinaryKind::OBJECT: return Type::OBJECT;
+    default                      : return Type::NUL;
+    }
+}
+
+inline Result<bool> BinaryValue::getBool() const noexcept {
+    const Result<impl::BinaryHeader> header = impl::readHeader(ptr_, end_);
+    if (header.bad()) return header.err();
+
+    switch (header.val().kind) {
+    case impl::BinaryKind::BOOL_FALSE: return false;
+    case impl::BinaryKind::BOOL_TRUE : return true;
+    default                     : return Err::JSON_BAD_CAST;
+    }
+}
+
+inline Result<i64> BinaryValue::getI64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<i64>(number.val());
+}
+
+inline Result<u64> BinaryValue::getU64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<u64>(number.val());
+}
+
+inline Result<f64> BinaryValue::getF64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<f64>(number.val());
+}
+
+inline Result<Number> BinaryValue::getNumber() const noexcept {
+    const Result<impl::BinaryHeader> header = impl::readHeader(ptr_, end_);
+    if (header.bad()) return header.err();
+
+    switch (header.val().kind) {
+    case impl::BinaryKind::INT:
+        return Number{ .type = NumberType::INT, .bits = header.val().payload };
+    case impl::BinaryKind::UINT:
+        return Number{ .type = NumberType::UINT, .bits = header.val().payload };
+    case impl::BinaryKind::FLOAT:
+        return Number{ .type = NumberType::FLOAT,
+                       .bits = header.val().payload };
+    default: return Err::JSON_BAD_CAST;
+    }
+}
+
+inline Result<std::string_view> BinaryValue::getString() const noexcept {
+    const Result<impl::BinaryHeader> header = impl::readHeader(ptr_, end_);
+    if (header.bad()) return header.err();
+    if (header.val().kind != impl::BinaryKind::STRING)
+        return Err::JSON_BAD_CAST;
+
+    return std::string_view{ ptr_ + header.val().head,
+                             static_cast<usize>(header.val().payload) };
+}
+
+inline usize BinaryValue::size() const noexcept {
+    const Result<impl::BinaryHeader> header = impl::readHeader(ptr_, end_);
+    if (header.bad()) return 0;
+    if (header.val().kind != impl::BinaryKind::ARRAY &&
+        header.val().kind != impl::BinaryKind::OBJECT)
+        return 0;
+
+    return static_cast<usize>(header.val().payload);
+}
+
+inline BinaryIter BinaryValue::begin() const noexcept {
+    const std::span<const char> inner = body(impl::BinaryKind::ARRAY);
+    return { inner.data(), inner.data() + inner.size() };
+}
+
+inline BinaryIter BinaryValue::end() const noexcept {
+    const std::span<const char> inner = body(impl::BinaryKind::ARRAY);
+    return { inner.data() + inner.size(), inner.data() + inner.size() };
+}
+
+inline BinaryMemberIter BinaryValue::membersBegin() const noexcept {
+    const std::span<const char> inner = body(impl::BinaryKind::OBJECT);
+    return { inner.data(), inner.data() + inner.size() };
+}
+
+inline BinaryMemberIter BinaryValue::membersEnd() const noexcept {
+    const std::span<const char> inner = body(impl::BinaryKind::OBJECT);
+    return { inner.data() + inner.size(), inner.data() + inner.size() };
+}
+
+inline std::span<const char> BinaryValue::body(
+    impl::BinaryKind kind) const noexcept {
+    const Result<impl::BinaryHeader> header = impl::readHeader(ptr_, end_);
+    if (header.bad() || header.val().kind != kind) return {};
+
+    return { ptr_ + header.val().head, static_cast<usize>(header.val().body) };
+}
+
+inline Result<BinaryValue> readBinary(std::span<const char> data) noexcept {
+    return impl::BinaryAccess::root(data);
+}
+
+inline Result<BinaryValue> find(const BinaryValue &object,
+                                std::string_view   key) noexcept {
+    return impl::BinaryAccess::find(object, key);
+}
+
+inline Result<BinaryValue> at(const BinaryValue &array, usize index) noexcept {
+    return impl::BinaryAccess::at(array, index);
+}
+
+template<ValueWriter W>
+Status write(W &writer, const BinaryValue &value) noexcept {
+    switch (value.type()) {
+    case Type::NUL : return writer.null();
+    case Type::BOOL: {
+        const Result<bool> flag = value.getBool();
+        if (flag.bad()) return flag.err();
+
+        return writer.boolean(flag.val());
+    }
+    case Type::NUMBER: {
+        const Result<Number> number = value.getNumber();
+        if (number.bad()) return number.err();
+
+        return writer.number(number.val());
+    }
+    case Type::STRING: {
+        const Result<std::string_view> text = value.getString();
+        if (text.bad()) return text.err();
+
+        return writer.string(text.val());
+    }
+    case Type::ARRAY: {
+        const Status opened = writer.beginArray();
+        if (opened.bad()) return opened;
+
+        usize count = 0;
+        for (const BinaryValue child : value) {
+            const Status written = write(writer, child);
+            if (written.bad()) return written;
+
+            ++count;
+        }
+
+        if (count != value.size()) return Err::JSON_BAD_TOKEN;
+
+        return writer.endArray();
+    }
+    case Type::OBJECT: {
+        const Status opened = writer.beginObject();
+        if (opened.bad()) return opened;
+
+        usize                  count = 0;
+        const BinaryMemberIter end   = value.membersEnd();
+        for (BinaryMemberIter it = value.membersBegin(); it != end; ++it) {
+            const BinaryMember member = *it;
+
+            const Status       key    = writer.key(member.key);
+            if (key.bad()) return key;
+
+            const Status written = write(writer, member.value);
+            if (written.bad()) return written;
+
+            ++count;
+        }
+
+        if (count != value.size()) return Err::JSON_BAD_TOKEN;
+
+        return writer.endObject();
+    }
+    }
+
+    return {};
+}
+
+// BinaryAccess ---
+
+inline Result<BinaryValue> impl::BinaryAccess::root(
+    std::span<const char> data) noexcept {
+    const std::string_view bytes{ data.data(), data.size() };
+    if (!bytes.starts_with(BINARY_MAGIC)) return Err::JSON_BAD_TOKEN;
+
+    const char *const ptr = data.data() + BINARY_MAGIC.size();
+    const char *const end = data.data() + data.size();
+    if (ptr == end) return Err::JSON_SYNTAX_EXP_VALUE;
+
+    const usize extent = binaryExtent(ptr, end);
+    if (extent == 0) return Err::JSON_BAD_TOKEN;
+    if (extent != static_cast<usize>(end - ptr))
+        return Err::JSON_SYNTAX_DBL_ROOT;
+
+    return BinaryValue{ ptr, ptr + extent };
+}
+
+inline Result<BinaryValue> impl::BinaryAccess::find(
+    const BinaryValue &object,
+    std::string_view   key) noexcept {
+    const Result<BinaryHeader> header = readHeader(object.ptr_, object.end_);
+    if (header.bad()) return header.err();
+    if (header.val().kind != BinaryKind::OBJECT) return Err::JSON_BAD_CAST;
+
+    const char *ptr = object.ptr_ + header.val().head;
+    const char *end = ptr + header.val().body;
+    for (u64 i = 0; i < header.val().payload; ++i) {
+        const BinaryValue              name{ ptr, end };
+        const Result<std::string_view> text = name.getString();
+        if (text.bad()) return Err::JSON_BAD_TOKEN;
+
+        const char *const value  = text.val().data() + text.val().size();
+        const usize       extent = binaryExtent(value, end);
+        if (extent == 0) return Err::JSON_BAD_TOKEN;
+
+        if (text.val() == key) return BinaryValue{ value, value + extent };
+
+        ptr = value + extent;
+    }
+
+    return Err::NO_SUCH_KEY;
+}
+
+inline Result<BinaryValue> impl::BinaryAccess::at(const BinaryValue &array,
+                                                  usize index) noexcept {
+    const Result<BinaryHeader> header = readHeader(array.ptr_, array.end_);
+    if (header.bad()) return header.err();
+    if (header.val().kind != BinaryKind::ARRAY) return Err::JSON_BAD_CAST;
+    if (index >= header.val().payload) return Err::INDEX_OUT_OF_RANGE;
+
+    const char *ptr = array.ptr_ + header.val().head;
+    const char *end = ptr + header.val().body;
+    for (usize i = 0;; ++i) {
+        const usize extent = binaryExtent(ptr, end);
+        if (extent == 0) return Err::JSON_BAD_TOKEN;
+
+        if (i == index) return BinaryValue{ ptr, ptr + extent };
+
+        ptr += extent;
+    }
+}
+
+// BinaryIter ---
+
+inline BinaryIter::BinaryIter(const char *ptr, const char *end) noexcept :
+    ptr_{ impl::binaryExtent(ptr, end) == 0 ? end : ptr },
+    end_{ end } {}
+
+inline BinaryValue BinaryIter::operator*() const noexcept {
+    return { ptr_, ptr_ + impl::binaryExtent(ptr_, end_) };
+}
+
+inline BinaryIter &BinaryIter::operator++() noexcept {
+    const char *const next = ptr_ + impl::binaryExtent(ptr_, end_);
+    ptr_ = impl::binaryExtent(next, end_) == 0 ? end_ : next;
+    return *this;
+}
+
+inline bool BinaryIter::operator==(const BinaryIter &rhs) const noexcept {
+    return ptr_ == rhs.ptr_;
+}
+
+// BinaryMemberIter ---
+
+inline BinaryMemberIter::BinaryMemberIter(const char *ptr,
+                                          const char *end) noexcept :
+    ptr_{ extent(ptr, end) == 0 ? end : ptr },
+    end_{ end } {}
+
+inline BinaryMember BinaryMemberIter::operator*() const noexcept {
+    const usize       key   = impl::binaryExtent(ptr_, end_);
+    const char *const value = ptr_ + key;
+    const usize       head  = impl::readHeader(ptr_, end_).val().head;
+
+    return {
+        .key   = { ptr_ + head, key - head },
+        .value = { value, value + impl::binaryExtent(value, end_) },
+    };
+}
+
+inline BinaryMemberIter &BinaryMemberIter::operator++() noexcept {
+    const char *const next = ptr_ + extent(ptr_, end_);
+    ptr_ = extent(next, end_) == 0 ? end_ : next;
+    return *this;
+}
+
+inline bool BinaryMemberIter::operator==(
+    const BinaryMemberIter &rhs) const noexcept {
+    return ptr_ == rhs.ptr_;
+}
+
+inline usize BinaryMemberIter::extent(const char *ptr,
+                                      const char *end) noexcept {
+    const Result<impl::BinaryHeader> key = impl::readHeader(ptr, end);
+    if (key.bad() || key.val().kind != impl::BinaryKind::STRING) return 0;
+
+    const usize name  = impl::binaryExtent(ptr, end);
+    const usize value = impl::binaryExtent(ptr + name, end);
+    if (value == 0) return 0;
+
+    return name + value;
+}
+
+// BinaryWriter ---
+
+inline BinaryWriter::BinaryWriter() noexcept :
+    size_{ 0 },
+    depth_{ 0 },
+    status_{},
+    expect_{ Expect::ROOT } {
+    clear();
+}
+
+inline Status BinaryWriter::status() const noexcept { return status_; }
+
+inline std::string_view BinaryWriter::view() const noexcept {
+    return { buffer_.data(), size_ };
+}
+
+inline void BinaryWriter::clear() noexcept {
+    size_   = 0;
+    depth_  = 0;
+    expect_ = Expect::ROOT;
+
+    const Status reserved = buffer_.reserve(impl::BINARY_MAGIC.size());
+    if (reserved.bad()) {
+        status_ = reserved;
+        return;
+    }
+
+    std::memcpy(buffer_.data(), impl::BINARY_MAGIC.data(),
+                impl::BINARY_MAGIC.size());
+    size_   = impl::BINARY_MAGIC.size();
+    status_ = {};
+}
+
+inline Status BinaryWriter::beginObject() noexcept {
+    return open(impl::BinaryKind::OBJECT, Expect::KEY);
+}
+
+inline Status BinaryWriter::endObject() noexcept { return close(Expect::KEY); }
+
+inline Status BinaryWriter::beginArray() noexcept {
+    return open(impl::BinaryKind::ARRAY, Expect::VALUE);
+}
+
+inline Status BinaryWriter::endArray() noexcept { return close(Expect::VALUE); }
+
+inline Status BinaryWriter::key(std::string_view key) noexcept {
+    if (status_.bad()) return status_;
+
+    if (expect_ != Expect::KEY)
+        return fail(expect_ == Expect::DONE ? Err::JSON_SYNTAX_DBL_ROOT
+                                            : Err::JSON_SYNTAX_EXP_VALUE);
+
+    const Status written = chars(key);
+    if (written.bad()) return written;
+
+    expect_ = Expect::MEMBER;
+    return {};
+}
+
+inline Status BinaryWriter::string(std::string_view text) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    const Status written = chars(text);
+    if (written.bad()) return written;
+
+    advance();
+    return {};
+}
+
+inline Status BinaryWriter::number(Number number) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    const Status reserved = reserve(impl::BINARY_MAX_SCALAR);
+    if (reserved.bad()) return reserved;
+
+    switch (number.type) {
+    case NumberType::INT:
+        scalar(impl::BinaryKind::INT,
+               impl::signedWidthCode(std::bit_cast<i64>(number.bits)),
+               number.bits);
+        break;
+    case NumberType::UINT:
+        scalar(impl::BinaryKind::UINT, impl::widthCode(number.bits),
+               number.bits);
+        break;
+    case NumberType::FLOAT:
+        scalar(impl::BinaryKind::FLOAT, impl::BINARY_FLOAT_CODE, number.bits);
+        break;
+    }
+
+    advance();
+    return {};
+}
+
+inline Status BinaryWriter::boolean(bool value) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    const Status reserved = reserve(1);
+    if (reserved.bad()) return reserved;
+
+    scalar(value ? impl::BinaryKind::BOOL_TRUE : impl::BinaryKind::BOOL_FALSE,
+           0,
+           0);
+    advance();
+    return {};
+}
+
+inline Status BinaryWriter::null() noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    const Status reserved = reserve(1);
+    if (reserved.bad()) return reserved;
+
+    scalar(impl::BinaryKind::NUL, 0, 0);
+    advance();
+    return {};
+}
+
+template<NumberValue T>
+Status BinaryWriter::number(T value) noexcept {
+    return number(makeNumber(value));
+}
+
+inline Status BinaryWriter::prefix() noexcept {
+    if (status_.bad()) return status_;
+
+    switch (expect_) {
+    case Expect::ROOT  : [[fallthrough]];
+    case Expect::VALUE : [[fallthrough]];
+    case Expect::MEMBER: return {};
+    case Expect::KEY   : return fail(Err::JSON_SYNTAX_EXP_KEY);
+    case Expect::DONE  : return fail(Err::JSON_SYNTAX_DBL_ROOT);
+    }
+
+    return {};
+}
+
+inline Status BinaryWriter::open(impl::BinaryKind kind, Expect inner) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    if (depth_ == impl::JSON_MAX_DEPTH) return fail(Err::CAPACITY_EXCEEDED);
+
+    const Status frames = frames_.reserve(depth_ + 1);
+    if (frames.bad()) return fail(frames.err());
+
+    const Status reserved = reserve(impl::BINARY_FRAME_HEADER);
+    if (reserved.bad()) return reserved;
+
+    frames_.data()[depth_++] = { .header = size_, .count = 0, .inner = inner };
+
+    buffer_.data()[size_]    = static_cast<char>(
+        impl::binaryTag(kind, impl::BINARY_FIELD_CODE));
+    size_   += impl::BINARY_FRAME_HEADER;
+
+    expect_  = inner;
+    return {};
+}
+
+inline Status BinaryWriter::close(Expect inner) noexcept {
+    if (status_.bad()) return status_;
+
+    if (depth_ == 0 || expect_ != inner)
+        return fail(expect_ == Expect::MEMBER ? Err::JSON_SYNTAX_EXP_VALUE
+                                              : Err::JSON_BAD_TOKEN);
+
+    const Frame frame = frames_.data()[--depth_];
+    const usize body  = size_ - frame.header - impl::BINARY_FRAME_HEADER;
+    if (body > U32_MAX || frame.count > U32_MAX)
+        return fail(Err::CAPACITY_EXCEEDED);
+
+    // Narrow the header of small containers by moving their body down.
+    const u8    code  = std::min(impl::widthCode(std::max<u64>(frame.count,
+                                                               body)),
+                                impl::BINARY_FIELD_CODE);
+    const usize width = usize{ 1 } << code;
+    char *const tag   = buffer_.data() + frame.header;
+    if (code != impl::BINARY_FIELD_CODE) {
+        std::memmove(tag + 1 + (2 * width), tag + impl::BINARY_FRAME_HEADER,
+                     body);
+        size_ -= 2 * (impl::BINARY_FIELD_WIDTH - width);
+    }
+
+    *tag = static_cast<char>(impl::binaryTag(
+        static_cast<impl::BinaryKind>(static_cast<u8>(*tag) >>
+                                      impl::BINARY_WIDTH_BITS),
+        code));
+    impl::writeLittle(tag + 1, frame.count, width);
+    impl::writeLittle(tag + 1 + width, body, width);
+
+    advance();
+    return {};
+}
+
+inline void BinaryWriter::advance() noexcept {
+    if (depth_ == 0) {
+        expect_ = Expect::DONE;
+        return;
+    }
+
+    Frame &top = frames_.data()[depth_ - 1];
+    ++top.count;
+    expect_ = top.inner;
+}
+
+inline Status BinaryWriter::reserve(usize count) noexcept {
+    if (count > USIZE_MAX - size_) return fail(Err::OUT_OF_MEMORY);
+
+    const Status reserved = buffer_.reserve(size_ + count);
+    if (reserved.bad()) return fail(reserved.err());
+
+    return {};
+}
+
+inline Status BinaryWriter::chars(std::string_view text) noexcept {
+    const Status reserved = reserve(impl::BINARY_MAX_SCALAR + text.size());
+    if (reserved.bad()) return reserved;
+
+    scalar(impl::BinaryKind::STRING, impl::widthCode(text.size()), text.size());
+    std::memcpy(buffer_.data() + size_, text.data(), text.size());
+    size_ += text.size();
+    return {};
+}
+
+inline void BinaryWriter::scalar(impl::BinaryKind kind,
+                                 u8               code,
+                                 u64              bits) noexcept {
+    buffer_.data()[size_++] = static_cast<char>(impl::binaryTag(kind, code));
+
+    if (kind == impl::BinaryKind::NUL || kind == impl::BinaryKind::BOOL_FALSE ||
+        kind == impl::BinaryKind::BOOL_TRUE)
+        return;
+
+    const usize width = usize{ 1 } << code;
+    impl::writeLittle(buffer_.data() + size_, bits, width);
+    size_ += width;
+}
+
+inline Err BinaryWriter::fail(Err err) noexcept {
+    status_ = err;
+    return err;
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_BINARY_HPP
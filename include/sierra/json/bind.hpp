@@ -0,0 +1,417 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_BIND_HPP
+#define SRR_JSON_BIND_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/json/binary.hpp"
+#include "sierra/json/lazy.hpp"
+#include "sierra/json/parser.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/json/writer.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/consteval.hpp"
+#include "sierra/utils/lookup.hpp"
+
+#include <array>
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+inline namespace srr {
+namespace json {
+
+// JSON key of one member of a bound aggregate.
+template<typename T, typename M>
+struct Field {
+    std::string_view name;
+    M T::*member;
+};
+
+// Specialize with a static constexpr std::tuple FIELDS of Field values to
+// bind T. Names must be unique, a clash fails to compile.
+//
+//     template<>
+//     struct json::Binding<Config> {
+//         static constexpr std::tuple FIELDS{
+//             json::makeField("name", &Config::name),
+//             json::makeField("size", &Config::size),
+//         };
+//     };
+template<typename T>
+struct Binding {};
+
+namespace impl {
+
+template<typename T>
+struct BindVector : std::false_type {};
+
+template<typename T>
+struct BindVector<std::vector<T>> : std::true_type {};
+
+template<typename T>
+struct BindAccess;
+
+template<>
+struct BindAccess<Element> {
+    using MemberType  = Member;
+    using Iter        = MemberIter;
+    using ElementIter = json::ElementIter;
+};
+
+template<>
+struct BindAccess<LazyValue> {
+    using MemberType  = LazyMember;
+    using Iter        = LazyMemberIter;
+    using ElementIter = LazyIter;
+};
+
+template<>
+struct BindAccess<BinaryValue> {
+    using MemberType  = BinaryMember;
+    using Iter        = BinaryMemberIter;
+    using ElementIter = BinaryIter;
+};
+
+} // namespace impl
+
+template<typename T>
+concept Bound = requires {
+    std::tuple_size<std::remove_cvref_t<decltype(Binding<T>::FIELDS)>>::value;
+};
+
+namespace impl {
+
+template<typename T>
+struct BindValue
+    : std::bool_constant<std::same_as<T, bool> || std::integral<T> ||
+                         std::floating_point<T> ||
+                         std::same_as<T, std::string> || Bound<T>> {};
+
+// std::vector<bool> hands out proxies instead of references.
+template<typename T>
+struct BindValue<std::vector<T>>
+    : std::bool_constant<!std::same_as<T, bool> && BindValue<T>::value> {};
+
+} // namespace impl
+
+// Values encode() and decode() handle. Vectors hold any of them but bool.
+template<typename T>
+concept Bindable = impl::BindValue<T>::value;
+
+// Documents decode() reads from.
+template<typename V>
+concept BindSource = std::same_as<V, Element> || std::same_as<V, LazyValue> ||
+                     std::same_as<V, BinaryValue>;
+
+template<typename T, typename M>
+[[nodiscard]] consteval Field<T, M> makeField(std::string_view name,
+                                              M T::*member) noexcept;
+
+// Decodes value into out with no intermediate tree. Object members missing
+// from the JSON keep their values and unknown keys are skipped, one perfect
+// hash probe each. Fails with JSON_BAD_CAST when a JSON type does not match
+// the member's, JSON_BAD_SUBTYPE when a number does not fit it, and with
+// the errors of the source. A LazyValue source validates only what is read,
+// but every container decoded must be read up to its closing bracket.
+template<BindSource V, Bindable T>
+[[nodiscard]] Status decode(const V &value, T &out) noexcept;
+
+// Indexes text with parser and decodes its root.
+template<Bindable T>
+[[nodiscard]] Status decode(LazyParser      &parser,
+                            std::string_view text,
+                            T               &out) noexcept;
+
+// Objects are written with their members in declaration order.
+template<ValueWriter W, Bindable T>
+[[nodiscard]] Status encode(W &writer, const T &value) noexcept;
+
+namespace impl {
+
+template<Bound T>
+constexpr usize BIND_FIELDS =
+    std::tuple_size_v<std::remove_cvref_t<decltype(Binding<T>::FIELDS)>>;
+
+template<typename V, typename T>
+using FieldDecoder = Status (*)(const V &value, T &out) noexcept;
+
+template<Bound T>
+[[nodiscard]] consteval std::array<std::string_view, BIND_FIELDS<T>>
+    bindNames() noexcept;
+
+template<typename V, typename T, usize... I>
+[[nodiscard]] consteval std::array<FieldDecoder<V, T>, sizeof...(I)>
+    bindDecoders(std::index_sequence<I...> seq) noexcept;
+
+template<Bound T>
+constexpr utils::PerfectHash<BIND_FIELDS<T>> BIND_HASH =
+    utils::makePerfectHash(bindNames<T>());
+
+// Decoder per field, indexed like BIND_HASH.
+template<typename V, Bound T>
+constexpr std::array<FieldDecoder<V, T>, BIND_FIELDS<T>> BIND_DECODERS =
+    bindDecoders<V, T>(std::make_index_sequence<BIND_FIELDS<T>>{});
+
+[[nodiscard]] inline Result<std::string_view> memberKey(
+    const Member &member) noexcept;
+[[nodiscard]] inline Result<std::string_view> memberKey(
+    const LazyMember &member) noexcept;
+[[nodiscard]] inline Result<std::string_view> memberKey(
+    const BinaryMember &member) noexcept;
+
+template<BindSource V, Bindable T>
+[[nodiscard]] Status decodeValue(const V &value, T &out) noexcept;
+
+template<BindSource V, Bound T>
+[[nodiscard]] Status decodeObject(const V &value, T &out) noexcept;
+
+template<typename V, typename T, usize I>
+[[nodiscard]] Status decodeField(const V &value, T &out) noexcept;
+
+// Whether iteration that ended at iter after count children read all of
+// value. Tapes are validated whole by the parser, lazy iterators report
+// where they stopped and binary containers carry their size.
+template<BindSource V, typename I>
+[[nodiscard]] Status decodeEnded(const V &value,
+                                 const I &iter,
+                                 usize    count) noexcept;
+
+template<ValueWriter W, Bindable T>
+[[nodiscard]] Status encodeValue(W &writer, const T &value) noexcept;
+
+template<ValueWriter W, Bound T>
+[[nodiscard]] Status encodeObject(W &writer, const T &value) noexcept;
+
+} // namespace impl
+
+template<typename T, typename M>
+consteval Field<T, M> makeField(std::string_view name, M T::*member) noexcept {
+    return { .name = name, .member = member };
+}
+
+template<BindSource V, Bindable T>
+Status decode(const V &value, T &out) noexcept {
+    return impl::decodeValue(value, out);
+}
+
+template<Bindable T>
+Status decode(LazyParser &parser, std::string_view text, T &out) noexcept {
+    const Result<LazyDocument> document = parser.parse(text);
+    if (document.bad()) return document.err();
+
+    return impl::decodeValue(document.val().root(), out);
+}
+
+template<ValueWriter W, Bindable T>
+Status encode(W &writer, const T &value) noexcept {
+    return impl::encodeValue(writer, value);
+}
+
+namespace impl {
+
+template<Bound T>
+consteval std::array<std::string_view, BIND_FIELDS<T>> bindNames() noexcept {
+    std::array<std::string_view, BIND_FIELDS<T>> names{};
+    utils::forEachIndex<BIND_FIELDS<T>>(
+        [&]<usize I> { names[I] = std::get<I>(Binding<T>::FIELDS).name; });
+    return names;
+}
+
+template<typename V, typename T, usize... I>
+consteval std::array<FieldDecoder<V, T>, sizeof...(I)> bindDecoders(
+    [[maybe_unused]] std::index_sequence<I...> seq) noexcept {
+    return { &decodeField<V, T, I>... };
+}
+
+inline Result<std::string_view> memberKey(const Member &member) noexcept {
+    return member.key;
+}
+
+inline Result<std::string_view> memberKey(const LazyMember &member) noexcept {
+    return member.key.getString();
+}
+
+inline Result<std::string_view> memberKey(
+    const BinaryMember &member) noexcept {
+    return member.key;
+}
+
+template<BindSource V, Bindable T>
+Status decodeValue(const V &value, T &out) noexcept {
+    if constexpr (std::same_as<T, bool>) {
+        const Result<bool> got = value.getBool();
+        if (got.bad()) return got.err();
+
+        out = got.val();
+    } else if constexpr (std::signed_integral<T>) {
+        const Result<i64> got = value.getI64();
+        if (got.bad()) return got.err();
+        if (!std::in_range<T>(got.val())) return Err::JSON_BAD_SUBTYPE;
+
+        out = static_cast<T>(got.val());
+    } else if constexpr (std::unsigned_integral<T>) {
+        const Result<u64> got = value.getU64();
+        if (got.bad()) return got.err();
+        if (!std::in_range<T>(got.val())) return Err::JSON_BAD_SUBTYPE;
+
+        out = static_cast<T>(got.val());
+    } else if constexpr (std::floating_point<T>) {
+        const Result<f64> got = value.getF64();
+        if (got.bad()) return got.err();
+
+        out = static_cast<T>(got.val());
+    } else if constexpr (std::same_as<T, std::string>) {
+        const Result<std::string_view> got = value.getString();
+        if (got.bad()) return got.err();
+
+        out.assign(got.val());
+    } else if constexpr (BindVector<T>::value) {
+        if (value.type() != Type::ARRAY) return Err::JSON_BAD_CAST;
+
+        using Iter = typename BindAccess<V>::ElementIter;
+
+        out.clear();
+
+        const Iter end = value.end();
+        Iter       it  = value.begin();
+        for (; it != end; ++it) {
+            const Status decoded = decodeValue(*it, out.emplace_back());
+            if (decoded.bad()) return decoded;
+        }
+
+        return decodeEnded(value, it, out.size());
+    } else {
+        return decodeObject(value, out);
+    }
+
+    return {};
+}
+
+template<BindSource V, Bound T>
+Status decodeObject(const V &value, T &out) noexcept {
+    using Access = BindAccess<V>;
+
+    if (value.type() != Type::OBJECT) return Err::JSON_BAD_CAST;
+
+    usize                       count = 0;
+    const typename Access::Iter end   = value.membersEnd();
+    typename Access::Iter       it    = value.membersBegin();
+    for (; it != end; ++it, ++count) {
+        const typename Access::MemberType member = *it;
+
+        const Result<std::string_view>    key    = memberKey(member);
+        if (key.bad()) return key.err();
+
+        const usize field = BIND_HASH<T>.indexOf(key.val());
+        if (field == utils::PerfectHash<BIND_FIELDS<T>>::MISS) continue;
+
+        const Status decoded = BIND_DECODERS<V, T>[field](member.value, out);
+        if (decoded.bad()) return decoded;
+    }
+
+    return decodeEnded(value, it, count);
+}
+
+template<typename V, typename T, usize I>
+Status decodeField(const V &value, T &out) noexcept {
+    return decodeValue(value, out.*(std::get<I>(Binding<T>::FIELDS).member));
+}
+
+template<BindSource V, typename I>
+Status decodeEnded([[maybe_unused]] const V &value,
+                   [[maybe_unused]] const I &iter,
+                   [[maybe_unused]] usize    count) noexcept {
+    if constexpr (std::same_as<V, LazyValue>) {
+        return iter.status();
+    } else if constexpr (std::same_as<V, BinaryValue>) {
+        if (count != value.size()) return Err::JSON_BAD_TOKEN;
+    }
+
+    return {};
+}
+
+template<ValueWriter W, Bindable T>
+Status encodeValue(W &writer, const T &value) noexcept {
+    if constexpr (std::same_as<T, bool>) {
+        return writer.boolean(value);
+    } else if constexpr (std::signed_integral<T>) {
+        return writer.number(makeNumber(static_cast<i64>(value)));
+    } else if constexpr (std::unsigned_integral<T>) {
+        return writer.number(makeNumber(static_cast<u64>(value)));
+    } else if constexpr (std::floating_point<T>) {
+        return writer.number(makeNumber(static_cast<f64>(value)));
+    } else if constexpr (std::same_as<T, std::string>) {
+        return writer.string(value);
+    } else if constexpr (BindVector<T>::value) {
+        const Status opened = writer.beginArray();
+        if (opened.bad()) return opened;
+
+        for (const typename T::value_type &child : value) {
+            const Status encoded = encodeValue(writer, child);
+            if (encoded.bad()) return encoded;
+        }
+
+        return writer.endArray();
+    } else {
+        return encodeObject(writer, value);
+    }
+}
+
+template<ValueWriter W, Bound T>
+Status encodeObject(W &writer, const T &value) noexcept {
+    Status status = writer.beginObject();
+
+    utils::forEachIndex<BIND_FIELDS<T>>([&]<usize I> {
+        if (status.bad()) return;
+
+        const Field field = std::get<I>(Binding<T>::FIELDS);
+
+        status            = writer.key(field.name);
+        if (status.ok()) status = encodeValue(writer, value.*(field.member));
+    });
+
+    if (status.bad()) return status;
+
+    return writer.endObject();
+}
+
+} // namespace impl
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_BIND_HPP
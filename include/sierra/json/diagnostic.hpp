@@ -0,0 +1,215 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_DIAGNOSTIC_HPP
+#define SRR_JSON_DIAGNOSTIC_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/utils/char.hpp"
+#include "sierra/utils/simd.hpp"
+#include "sierra/utils/utf8.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <string>
+#include <string_view>
+
+inline namespace srr {
+namespace json {
+
+// Where and why a parse failed. Lines and columns start at 1, columns count
+// code points so they match what editors show.
+struct Diagnostic {
+    Err              err;
+    usize            offset;
+    usize            line;
+    usize            column;
+
+    // Up to impl::DIAG_CONTEXT bytes of the line on each side of offset,
+    // caret is the byte offset's position within it.
+    std::string_view snippet;
+    usize            caret;
+};
+
+namespace impl {
+
+constexpr usize DIAG_CONTEXT = 40;
+
+struct DiagLines {
+    usize count;
+    usize start;
+};
+
+// Newlines in text and the offset past the last one, 16 bytes at a time.
+[[nodiscard]] inline DiagLines diagLines(std::string_view text) noexcept;
+
+// Bytes in text that are not UTF-8 continuation bytes.
+[[nodiscard]] inline usize     diagCodepoints(std::string_view text) noexcept;
+
+[[nodiscard]] constexpr bool   diagContinuation(char chr) noexcept;
+
+} // namespace impl
+
+// Locates offset in text, the text that failed to parse, typically with the
+// error and Parser::errorOffset(). Everything is computed here, so parsing
+// pays nothing for diagnostics until one is asked for. The snippet views
+// text, which must outlive the Diagnostic.
+[[nodiscard]] inline Diagnostic  diagnose(std::string_view text,
+                                          Err              err,
+                                          usize            offset) noexcept;
+
+// "line 3, column 14: <lookupMsg(err)>", then the snippet and a caret line
+// under it. Tabs are kept in the caret line so it stays aligned.
+[[nodiscard]] inline std::string formatDiagnostic(
+    const Diagnostic &diag) noexcept;
+
+namespace impl {
+
+inline DiagLines diagLines(std::string_view text) noexcept {
+    const utils::U8x16 newline = utils::U8x16::splat(utils::LF);
+    const char        *ptr     = text.data();
+
+    DiagLines          lines{ .count = 0, .start = 0 };
+    usize              pos = 0;
+
+    for (; pos + utils::SIMD_WIDTH <= text.size(); pos += utils::SIMD_WIDTH) {
+        const u32 bits = utils::U8x16::load(ptr + pos).eq(newline).mask();
+        if (bits == 0) continue;
+
+        lines.count += static_cast<usize>(std::popcount(bits));
+        lines.start  = pos + static_cast<usize>(std::bit_width(bits));
+    }
+
+    for (; pos < text.size(); ++pos) {
+        if (ptr[pos] != utils::LF) continue;
+
+        ++lines.count;
+        lines.start = pos + 1;
+    }
+
+    return lines;
+}
+
+inline usize diagCodepoints(std::string_view text) noexcept {
+    const utils::U8x16 cont_mask =
+        utils::U8x16::splat(utils::impl::UTF8_CONT_MASK);
+    const utils::U8x16 cont_tag =
+        utils::U8x16::splat(utils::impl::UTF8_CONT_TAG);
+    const char *ptr   = text.data();
+
+    usize       count = text.size();
+    usize       pos   = 0;
+
+    for (; pos + utils::SIMD_WIDTH <= text.size(); pos += utils::SIMD_WIDTH) {
+        const u32 bits = utils::U8x16::load(ptr + pos)
+                             .bitAnd(cont_mask)
+                             .eq(cont_tag)
+                             .mask();
+        count -= static_cast<usize>(std::popcount(bits));
+    }
+
+    for (; pos < text.size(); ++pos)
+        if (diagContinuation(ptr[pos])) --count;
+
+    return count;
+}
+
+constexpr bool diagContinuation(char chr) noexcept {
+    return (static_cast<u8>(chr) & utils::impl::UTF8_CONT_MASK) ==
+           utils::impl::UTF8_CONT_TAG;
+}
+
+} // namespace impl
+
+inline Diagnostic diagnose(std::string_view text,
+                           Err              err,
+                           usize            offset) noexcept {
+    offset                       = std::min(offset, text.size());
+
+    const impl::DiagLines lines  = impl::diagLines(text.substr(0, offset));
+    const usize           column = impl::diagCodepoints(
+        text.substr(lines.start, offset - lines.start));
+
+    // Clip the line to the context around offset without splitting a
+    // sequence at either end.
+    usize first = std::max(lines.start,
+                           offset - std::min(offset, impl::DIAG_CONTEXT));
+    while (first < offset && impl::diagContinuation(text[first])) ++first;
+
+    const usize limit = std::min(text.size(), offset + impl::DIAG_CONTEXT);
+    usize       last  = offset;
+    while (last < limit && text[last] != utils::LF) ++last;
+
+    if (last == limit)
+        while (last > offset && last < text.size() &&
+               impl::diagContinuation(text[last]))
+            --last;
+
+    while (last > offset && text[last - 1] == utils::CR) --last;
+
+    return {
+        .err     = err,
+        .offset  = offset,
+        .line    = lines.count + 1,
+        .column  = column + 1,
+        .snippet = text.substr(first, last - first),
+        .caret   = offset - first,
+    };
+}
+
+inline std::string formatDiagnostic(const Diagnostic &diag) noexcept {
+    std::string msg{};
+
+    msg += "line ";
+    msg += std::to_string(diag.line);
+    msg += ", column ";
+    msg += std::to_string(diag.column);
+    msg += ": ";
+    msg += lookupMsg(diag.err);
+    msg += utils::LF;
+
+    msg += diag.snippet;
+    msg += utils::LF;
+
+    for (const char chr : diag.snippet.substr(0, diag.caret)) {
+        if (impl::diagContinuation(chr)) continue;
+
+        msg += chr == utils::HT ? utils::HT : utils::SPACE;
+    }
+
+    msg += utils::CARET;
+
+    return msg;
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_DIAGNOSTIC_HPP
@@ -0,0 +1,646 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_DOM_HPP
+#define SRR_JSON_DOM_HPP
+
+#include "sierra/alloc/arena.hpp"
+#include "sierra/cont/flatmap.hpp"
+#include "sierra/error.hpp"
+#include "sierra/json/index.hpp"
+#include "sierra/json/parser.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+
+inline namespace srr {
+namespace json {
+
+class DomDocument;
+class DomValue;
+
+struct DomMember;
+
+namespace impl {
+
+constexpr usize DOM_MIN_CAPACITY = 4;
+
+} // namespace impl
+
+// Mutable JSON value, trivially copyable. Scalars are held inline, strings,
+// arrays and objects point into the arena of the DomDocument that made
+// them and must only be used with that document.
+class DomValue {
+public:
+    // Null.
+    [[nodiscard]] DomValue() noexcept;
+
+    [[nodiscard]] Type                     type() const noexcept;
+
+    // Fails with JSON_BAD_CAST when the value is of another type and with
+    // JSON_BAD_SUBTYPE when a number does not fit the requested one.
+    [[nodiscard]] Result<bool>             getBool() const noexcept;
+    [[nodiscard]] Result<i64>              getI64() const noexcept;
+    [[nodiscard]] Result<u64>              getU64() const noexcept;
+    [[nodiscard]] Result<f64>              getF64() const noexcept;
+    [[nodiscard]] Result<Number>           getNumber() const noexcept;
+    [[nodiscard]] Result<std::string_view> getString() const noexcept;
+
+    // Children of an array or object, zero for anything else.
+    [[nodiscard]] usize                    size() const noexcept;
+
+    // Empty for values of another type. Members are ordered by key id, see
+    // DomDocument.
+    [[nodiscard]] std::span<DomValue>        elements() noexcept;
+    [[nodiscard]] std::span<const DomValue>  elements() const noexcept;
+    [[nodiscard]] std::span<DomMember>       members() noexcept;
+    [[nodiscard]] std::span<const DomMember> members() const noexcept;
+
+private:
+    friend class DomDocument;
+
+    friend DomValue makeDomBool(bool value) noexcept;
+    friend DomValue makeDomNumber(Number number) noexcept;
+
+    Type       type_;
+    NumberType number_;
+    u32        size_;
+    u32        capacity_;
+    u64        bits_;
+    void      *data_;
+};
+
+struct DomMember {
+    u32      key;
+    DomValue value;
+};
+
+namespace impl {
+
+[[nodiscard]] constexpr bool domKeyLess(const DomMember &lhs,
+                                        const DomMember &rhs) noexcept;
+
+} // namespace impl
+
+[[nodiscard]] inline DomValue makeDomNull() noexcept;
+[[nodiscard]] inline DomValue makeDomBool(bool value) noexcept;
+[[nodiscard]] inline DomValue makeDomNumber(Number number) noexcept;
+
+template<NumberValue T>
+[[nodiscard]] DomValue makeDomNumber(T value) noexcept;
+
+// Owner of a JSON tree whose nodes, strings and keys all live in one arena,
+// so building it is a bump allocation per container or string and tearing
+// it down is an arena reset, no node is ever freed on its own. Growing a
+// container moves it to a larger block and leaves the old one until then.
+//
+// Keys are interned into a per-document table and objects store the key ids
+// in a flat array sorted by id. A lookup is one hash probe for the id and a
+// binary search over the members, and a missing key usually fails at the
+// probe. Member order is therefore key id order, not insertion order.
+//
+// Not thread-safe, const access may be shared between threads.
+class DomDocument {
+public:
+    [[nodiscard]] DomDocument() noexcept;
+    [[nodiscard]] explicit DomDocument(usize chunk_size) noexcept;
+    [[nodiscard]] DomDocument(DomDocument &&document) noexcept;
+
+    DomDocument(const DomDocument &document)            = delete;
+    DomDocument &operator=(const DomDocument &document) = delete;
+    DomDocument &operator=(DomDocument &&document)      = delete;
+
+    ~DomDocument() noexcept                             = default;
+
+    // Replaces the contents with a copy of document. Fails with
+    // JSON_SYNTAX_DBL_KEY when an object repeats a key, and OUT_OF_MEMORY.
+    [[nodiscard]] Status load(const Document &document) noexcept;
+
+    // Parses text with parser and loads the result.
+    [[nodiscard]] Status parse(Parser &parser, std::string_view text) noexcept;
+
+    // Drops every value and key, keeping the arena chunks for reuse.
+    void                 clear() noexcept;
+
+    [[nodiscard]] DomValue       &root() noexcept;
+    [[nodiscard]] const DomValue &root() const noexcept;
+
+    // Copies text into the arena.
+    [[nodiscard]] Result<DomValue> makeString(std::string_view text) noexcept;
+    [[nodiscard]] Result<DomValue> makeArray(usize capacity) noexcept;
+    [[nodiscard]] Result<DomValue> makeObject(usize capacity) noexcept;
+
+    // Id of key, interning it on first use.
+    [[nodiscard]] Result<u32>      intern(std::string_view key) noexcept;
+    [[nodiscard]] std::string_view key(u32 id) const noexcept;
+
+    // Fail with JSON_BAD_CAST when the container is of another type and
+    // with NO_SUCH_KEY or INDEX_OUT_OF_RANGE on a miss.
+    [[nodiscard]] Result<DomValue &> find(DomValue        &object,
+                                          std::string_view key) noexcept;
+    [[nodiscard]] Result<const DomValue &> find(
+        const DomValue  &object,
+        std::string_view key) const noexcept;
+    [[nodiscard]] Result<DomValue &> at(DomValue &array, usize index) noexcept;
+    [[nodiscard]] Result<const DomValue &> at(const DomValue &array,
+                                              usize index) const noexcept;
+
+    // Appends to an array.
+    [[nodiscard]] Status push(DomValue &array, DomValue value) noexcept;
+
+    // Inserts or replaces an object member.
+    [[nodiscard]] Status set(DomValue        &object,
+                             std::string_view key,
+                             DomValue         value) noexcept;
+
+    [[nodiscard]] Status erase(DomValue &object, std::string_view key) noexcept;
+
+private:
+    [[nodiscard]] Result<DomValue> convert(Element element) noexcept;
+
+    // Members before the first one with a key id not below key.
+    [[nodiscard]] static usize     lowerBound(const DomValue &object,
+                                              u32             key) noexcept;
+
+    template<typename T>
+    [[nodiscard]] Status grow(DomValue &container) noexcept;
+
+    alloc::Arena                         arena_;
+    cont::FlatMap<std::string_view, u32> ids_;
+    impl::JsonBuffer<std::string_view>   keys_;
+    u32                                  key_count_;
+    DomValue                             root_;
+};
+
+// DomValue ---
+
+inline DomValue::DomValue() noexcept :
+    type_{ Type::NUL },
+    number_{ NumberType::INT },
+    size_{ 0 },
+    capacity_{ 0 },
+    bits_{ 0 },
+    data_{ nullptr } {}
+
+inline Type         DomValue::type() const noexcept { return type_; }
+
+inline Result<bool> DomValue::getBool() const noexcept {
+    if (type_ != Type::BOOL) return Err::JSON_BAD_CAST;
+
+    return bits_ != 0;
+}
+
+inline Result<i64> DomValue::getI64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<i64>(number.val());
+}
+
+inline Result<u64> DomValue::getU64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<u64>(number.val());
+}
+
+inline Result<f64> DomValue::getF64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<f64>(number.val());
+}
+
+inline Result<Number> DomValue::getNumber() const noexcept {
+    if (type_ != Type::NUMBER) return Err::JSON_BAD_CAST;
+
+    return Number{ .type = number_, .bits = bits_ };
+}
+
+inline Result<std::string_view> DomValue::getString() const noexcept {
+    if (type_ != Type::STRING) return Err::JSON_BAD_CAST;
+
+    return std::string_view{ static_cast<const char *>(data_), size_ };
+}
+
+inline usize DomValue::size() const noexcept {
+    return type_ == Type::ARRAY || type_ == Type::OBJECT ? size_ : 0;
+}
+
+inline std::span<DomValue> DomValue::elements() noexcept {
+    if (type_ != Type::ARRAY) return {};
+
+    return { static_cast<DomValue *>(data_), size_ };
+}
+
+inline std::span<const DomValue> DomValue::elements() const noexcept {
+    if (type_ != Type::ARRAY) return {};
+
+    return { static_cast<const DomValue *>(data_), size_ };
+}
+
+inline std::span<DomMember> DomValue::members() noexcept {
+    if (type_ != Type::OBJECT) return {};
+
+    return { static_cast<DomMember *>(data_), size_ };
+}
+
+inline std::span<const DomMember> DomValue::members() const noexcept {
+    if (type_ != Type::OBJECT) return {};
+
+    return { static_cast<const DomMember *>(data_), size_ };
+}
+
+inline DomValue makeDomNull() noexcept { return {}; }
+
+inline DomValue makeDomBool(bool value) noexcept {
+    DomValue result{};
+    result.type_ = Type::BOOL;
+    result.bits_ = value ? 1 : 0;
+    return result;
+}
+
+inline DomValue makeDomNumber(Number number) noexcept {
+    DomValue result{};
+    result.type_   = Type::NUMBER;
+    result.number_ = number.type;
+    result.bits_   = number.bits;
+    return result;
+}
+
+template<NumberValue T>
+DomValue makeDomNumber(T value) noexcept {
+    return makeDomNumber(makeNumber(value));
+}
+
+namespace impl {
+
+constexpr bool domKeyLess(const DomMember &lhs, const DomMember &rhs) noexcept {
+    return lhs.key < rhs.key;
+}
+
+} // namespace impl
+
+// DomDocument ---
+
+inline DomDocument::DomDocument() noexcept :
+    arena_{},
+    ids_{},
+    keys_{},
+    key_count_{ 0 },
+    root_{} {}
+
+inline DomDocument::DomDocument(usize chunk_size) noexcept :
+    arena_{ chunk_size },
+    ids_{},
+    keys_{},
+    key_count_{ 0 },
+    root_{} {}
+
+inline DomDocument::DomDocument(DomDocument &&document) noexcept :
+    arena_{ std::move(document.arena_) },
+    ids_{ std::move(document.ids_) },
+    keys_{ std::move(document.keys_) },
+    key_count_{ std::exchange(document.key_count_, 0) },
+    root_{ std::exchange(document.root_, DomValue{}) } {}
+
+inline Status DomDocument::load(const Document &document) noexcept {
+    clear();
+
+    const Result<DomValue> root = convert(document.root());
+    if (root.bad()) {
+        clear();
+        return root.err();
+    }
+
+    root_ = root.val();
+    return {};
+}
+
+inline Status DomDocument::parse(Parser          &parser,
+                                 std::string_view text) noexcept {
+    const Result<Document> document = parser.parse(text);
+    if (document.bad()) return document.err();
+
+    return load(document.val());
+}
+
+inline void DomDocument::clear() noexcept {
+    arena_.reset();
+    ids_.clear();
+    key_count_ = 0;
+    root_      = {};
+}
+
+inline DomValue       &DomDocument::root() noexcept { return root_; }
+
+inline const DomValue &DomDocument::root() const noexcept { return root_; }
+
+inline Result<DomValue> DomDocument::makeString(
+    std::string_view text) noexcept {
+    if (text.size() > U32_MAX) return Err::CAPACITY_EXCEEDED;
+
+    const Result<char *> data = arena_.allocate<char>(text.size());
+    if (data.bad()) return data.err();
+
+    if (!text.empty()) std::memcpy(data.val(), text.data(), text.size());
+
+    DomValue result{};
+    result.type_ = Type::STRING;
+    result.size_ = static_cast<u32>(text.size());
+    result.data_ = data.val();
+    return result;
+}
+
+inline Result<DomValue> DomDocument::makeArray(usize capacity) noexcept {
+    if (capacity > U32_MAX) return Err::CAPACITY_EXCEEDED;
+
+    const Result<DomValue *> data = arena_.allocate<DomValue>(capacity);
+    if (data.bad()) return data.err();
+
+    DomValue result{};
+    result.type_     = Type::ARRAY;
+    result.capacity_ = static_cast<u32>(capacity);
+    result.data_     = data.val();
+    return result;
+}
+
+inline Result<DomValue> DomDocument::makeObject(usize capacity) noexcept {
+    if (capacity > U32_MAX) return Err::CAPACITY_EXCEEDED;
+
+    const Result<DomMember *> data = arena_.allocate<DomMember>(capacity);
+    if (data.bad()) return data.err();
+
+    DomValue result{};
+    result.type_     = Type::OBJECT;
+    result.capacity_ = static_cast<u32>(capacity);
+    result.data_     = data.val();
+    return result;
+}
+
+inline Result<u32> DomDocument::intern(std::string_view key) noexcept {
+    const Result<u32 &> found = ids_.find(key);
+    if (found.ok()) return found.val();
+
+    if (key_count_ == U32_MAX) return Err::CAPACITY_EXCEEDED;
+
+    const Status reserved = keys_.reserve(usize{ key_count_ } + 1);
+    if (reserved.bad()) return reserved.err();
+
+    const Result<DomValue> text = makeString(key);
+    if (text.bad()) return text.err();
+
+    const std::string_view stored = text.val().getString().val();
+    const u32              id     = key_count_++;
+
+    keys_.data()[id]              = stored;
+    ids_.insertOrAssign(std::string_view{ stored }, u32{ id });
+
+    return id;
+}
+
+inline std::string_view DomDocument::key(u32 id) const noexcept {
+    if (id >= key_count_) return {};
+
+    return keys_.data()[id];
+}
+
+inline Result<DomValue &> DomDocument::find(DomValue        &object,
+                                            std::string_view key) noexcept {
+    if (object.type_ != Type::OBJECT) return Err::JSON_BAD_CAST;
+
+    const Result<u32 &> id = ids_.find(key);
+    if (id.bad()) return Err::NO_SUCH_KEY;
+
+    const std::span<DomMember> members = object.members();
+    const usize                index   = lowerBound(object, id.val());
+    if (index == members.size() || members[index].key != id.val())
+        return Err::NO_SUCH_KEY;
+
+    return members[index].value;
+}
+
+inline Result<const DomValue &> DomDocument::find(
+    const DomValue  &object,
+    std::string_view key) const noexcept {
+    if (object.type_ != Type::OBJECT) return Err::JSON_BAD_CAST;
+
+    const Result<const u32 &> id = ids_.find(key);
+    if (id.bad()) return Err::NO_SUCH_KEY;
+
+    const std::span<const DomMember> members = object.members();
+    const usize                      index   = lowerBound(object, id.val());
+    if (index == members.size() || members[index].key != id.val())
+        return Err::NO_SUCH_KEY;
+
+    return members[index].value;
+}
+
+inline Result<DomValue &> DomDocument::at(DomValue &array,
+                                          usize     index) noexcept {
+    if (array.type_ != Type::ARRAY) return Err::JSON_BAD_CAST;
+    if (index >= array.size_) return Err::INDEX_OUT_OF_RANGE;
+
+    return array.elements()[index];
+}
+
+inline Result<const DomValue &> DomDocument::at(
+    const DomValue &array,
+    usize           index) const noexcept {
+    if (array.type_ != Type::ARRAY) return Err::JSON_BAD_CAST;
+    if (index >= array.size_) return Err::INDEX_OUT_OF_RANGE;
+
+    return array.elements()[index];
+}
+
+inline Status DomDocument::push(DomValue &array, DomValue value) noexcept {
+    if (array.type_ != Type::ARRAY) return Err::JSON_BAD_CAST;
+
+    const Status grown = grow<DomValue>(array);
+    if (grown.bad()) return grown;
+
+    static_cast<DomValue *>(array.data_)[array.size_++] = value;
+    return {};
+}
+
+inline Status DomDocument::set(DomValue        &object,
+                               std::string_view key,
+                               DomValue         value) noexcept {
+    if (object.type_ != Type::OBJECT) return Err::JSON_BAD_CAST;
+
+    const Result<u32> id = intern(key);
+    if (id.bad()) return id.err();
+
+    usize index = lowerBound(object, id.val());
+    if (index < object.size_ &&
+        static_cast<DomMember *>(object.data_)[index].key == id.val()) {
+        static_cast<DomMember *>(object.data_)[index].value = value;
+        return {};
+    }
+
+    const Status grown = grow<DomMember>(object);
+    if (grown.bad()) return grown;
+
+    DomMember *members = static_cast<DomMember *>(object.data_);
+    std::memmove(members + index + 1,
+                 members + index,
+                 (object.size_ - index) * sizeof(DomMember));
+
+    members[index] = { .key = id.val(), .value = value };
+    ++object.size_;
+
+    return {};
+}
+
+inline Status DomDocument::erase(DomValue        &object,
+                                 std::string_view key) noexcept {
+    if (object.type_ != Type::OBJECT) return Err::JSON_BAD_CAST;
+
+    const Result<u32 &> id = ids_.find(key);
+    if (id.bad()) return Err::NO_SUCH_KEY;
+
+    const usize index   = lowerBound(object, id.val());
+    DomMember  *members = static_cast<DomMember *>(object.data_);
+    if (index == object.size_ || members[index].key != id.val())
+        return Err::NO_SUCH_KEY;
+
+    std::memmove(members + index,
+                 members + index + 1,
+                 (object.size_ - index - 1) * sizeof(DomMember));
+    --object.size_;
+
+    return {};
+}
+
+inline Result<DomValue> DomDocument::convert(Element element) noexcept {
+    switch (element.type()) {
+    case Type::NUL   : return makeDomNull();
+    case Type::BOOL  : return makeDomBool(element.getBool().val());
+    case Type::NUMBER: return makeDomNumber(element.getNumber().val());
+    case Type::STRING: return makeString(element.getString().val());
+    case Type::ARRAY : {
+        Result<DomValue> array = makeArray(element.size());
+        if (array.bad()) return array.err();
+
+        DomValue *items = static_cast<DomValue *>(array.val().data_);
+        for (const Element child : element) {
+            const Result<DomValue> item = convert(child);
+            if (item.bad()) return item.err();
+
+            items[array.val().size_++] = item.val();
+        }
+
+        return array;
+    }
+    case Type::OBJECT: {
+        Result<DomValue> object = makeObject(element.size());
+        if (object.bad()) return object.err();
+
+        DomMember *members = static_cast<DomMember *>(object.val().data_);
+        for (MemberIter iter = element.membersBegin();
+             iter != element.membersEnd();
+             ++iter) {
+            const Member           member = *iter;
+
+            const Result<u32>      id     = intern(member.key);
+            if (id.bad()) return id.err();
+
+            const Result<DomValue> value  = convert(member.value);
+            if (value.bad()) return value.err();
+
+            members[object.val().size_++] = {
+                .key   = id.val(),
+                .value = value.val(),
+            };
+        }
+
+        // Repeated keys intern to the same id and end up side by side.
+        const usize size = object.val().size_;
+        std::sort(members, members + size, impl::domKeyLess);
+        for (usize index = 1; index < size; ++index) {
+            if (members[index].key == members[index - 1].key)
+                return Err::JSON_SYNTAX_DBL_KEY;
+        }
+
+        return object;
+    }
+    }
+
+    return makeDomNull();
+}
+
+inline usize DomDocument::lowerBound(const DomValue &object,
+                                     u32             key) noexcept {
+    const std::span<const DomMember> members = object.members();
+
+    usize                            first   = 0;
+    usize                            count   = members.size();
+    while (count > 0) {
+        const usize half = count / 2;
+        if (members[first + half].key < key) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+template<typename T>
+Status DomDocument::grow(DomValue &container) noexcept {
+    if (container.size_ < container.capacity_) return {};
+    if (container.capacity_ > U32_MAX / 2) return Err::CAPACITY_EXCEEDED;
+
+    const usize capacity = std::max<usize>(impl::DOM_MIN_CAPACITY,
+                                           usize{ container.capacity_ } * 2);
+
+    const Result<T *> data = arena_.allocate<T>(capacity);
+    if (data.bad()) return data.err();
+
+    if (container.size_ != 0)
+        std::memcpy(data.val(), container.data_, container.size_ * sizeof(T));
+
+    container.data_     = data.val();
+    container.capacity_ = static_cast<u32>(capacity);
+    return {};
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_DOM_HPP
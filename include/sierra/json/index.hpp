@@ -0,0 +1,421 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_INDEX_HPP
+#define SRR_JSON_INDEX_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/char.hpp"
+#include "sierra/utils/simd.hpp"
+#include "sierra/utils/utf8.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace json {
+
+namespace impl {
+
+constexpr usize JSON_BLOCK       = 64;
+constexpr usize JSON_BLOCK_LANES = JSON_BLOCK / utils::SIMD_WIDTH;
+constexpr u64   JSON_ODD_BITS    = 0xAAAA'AAAA'AAAA'AAAA;
+constexpr u32   JSON_LAST_BIT    = 63;
+constexpr u8    JSON_CONTROL_END = 0x20;
+
+// Growable array of trivial values, grown only by reserve() and never
+// shrunk, so parsers keep their storage between documents.
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class JsonBuffer {
+public:
+    [[nodiscard]] JsonBuffer() noexcept;
+    [[nodiscard]] JsonBuffer(JsonBuffer &&buffer) noexcept;
+
+    JsonBuffer(const JsonBuffer &buffer)            = delete;
+    JsonBuffer &operator=(const JsonBuffer &buffer) = delete;
+    JsonBuffer &operator=(JsonBuffer &&buffer)      = delete;
+
+    ~JsonBuffer() noexcept;
+
+    // Keeps the contents, fails with OUT_OF_MEMORY.
+    Status                reserve(usize count) noexcept;
+
+    [[nodiscard]] T      *data() noexcept;
+    [[nodiscard]] const T *data() const noexcept;
+    [[nodiscard]] usize   capacity() const noexcept;
+
+private:
+    T    *data_;
+    usize capacity_;
+};
+
+// Character classes of one 64 byte block, one bit per byte.
+struct JsonBlock {
+    u64 backslash;
+    u64 quote;
+    u64 op;
+    u64 space;
+    u64 control;
+};
+
+// Carries between blocks.
+struct JsonScanner {
+    u64 escaped;
+    u64 in_string;
+    u64 scalar;
+};
+
+[[nodiscard]] inline JsonBlock classifyBlock(const char *ptr) noexcept;
+[[nodiscard]] constexpr u64    prefixXor(u64 bits) noexcept;
+
+// Offset of the byte StructuralIndex::build() rejected text for with err.
+// Found with a plain rescan, as it is only needed after a failure.
+[[nodiscard]] inline usize     indexFault(std::string_view text,
+                                          Err              err) noexcept;
+
+} // namespace impl
+
+// Stage one of the parser, the positions of every structural character
+// ({ } [ ] : ,), of every opening quote and of the first byte of every other
+// scalar, found 64 bytes at a time with SIMD classification. The input is
+// validated as UTF-8 on the way and strings are checked for termination and
+// raw control characters.
+//
+// The list ends with a sentinel at the input size. Storage is kept between
+// builds, the index references the text, which must outlive it.
+class StructuralIndex {
+public:
+    [[nodiscard]] StructuralIndex() noexcept;
+    [[nodiscard]] StructuralIndex(StructuralIndex &&index) noexcept;
+
+    StructuralIndex(const StructuralIndex &index)            = delete;
+    StructuralIndex &operator=(const StructuralIndex &index) = delete;
+    StructuralIndex &operator=(StructuralIndex &&index)      = delete;
+
+    ~StructuralIndex() noexcept                              = default;
+
+    // Fails with INVALID_UTF8, JSON_BAD_TOKEN for unterminated strings and
+    // control characters in strings, CAPACITY_EXCEEDED past 4 GiB.
+    Status                             build(std::string_view text) noexcept;
+
+    [[nodiscard]] std::string_view     text() const noexcept;
+
+    // Without the sentinel.
+    [[nodiscard]] usize                size() const noexcept;
+    [[nodiscard]] std::span<const u32> positions() const noexcept;
+
+    // First byte of the structural at cursor, NUL past the end.
+    [[nodiscard]] char                 peek(usize cursor) const noexcept;
+
+    // Bytes from the structural at cursor up to the next one, less trailing
+    // whitespace.
+    [[nodiscard]] std::string_view     token(usize cursor) const noexcept;
+
+private:
+    impl::JsonBuffer<u32> positions_;
+    usize                 size_;
+    std::string_view      text_;
+};
+
+namespace impl {
+
+// JsonBuffer ---
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+JsonBuffer<T>::JsonBuffer() noexcept : data_{ nullptr }, capacity_{ 0 } {}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+JsonBuffer<T>::JsonBuffer(JsonBuffer &&buffer) noexcept :
+    data_{ std::exchange(buffer.data_, nullptr) },
+    capacity_{ std::exchange(buffer.capacity_, 0) } {}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+JsonBuffer<T>::~JsonBuffer() noexcept {
+    ::operator delete(data_, std::align_val_t{ alignof(T) });
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+Status JsonBuffer<T>::reserve(usize count) noexcept {
+    if (count <= capacity_) return {};
+    if (count > USIZE_MAX / sizeof(T)) return Err::OUT_OF_MEMORY;
+
+    // Grow geometrically so repeated reserves stay amortized.
+    const usize grown = std::max(count, capacity_ + (capacity_ / 2));
+
+    T          *data  = static_cast<T *>(::operator new(
+        grown * sizeof(T), std::align_val_t{ alignof(T) }, std::nothrow));
+    if (data == nullptr) return Err::OUT_OF_MEMORY;
+
+    if (data_ != nullptr) {
+        std::memcpy(data, data_, capacity_ * sizeof(T));
+        ::operator delete(data_, std::align_val_t{ alignof(T) });
+    }
+
+    data_     = data;
+    capacity_ = grown;
+    return {};
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+T *JsonBuffer<T>::data() noexcept {
+    return data_;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+const T *JsonBuffer<T>::data() const noexcept {
+    return data_;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+usize JsonBuffer<T>::capacity() const noexcept {
+    return capacity_;
+}
+
+inline JsonBlock classifyBlock(const char *ptr) noexcept {
+    const utils::U8x16 quote =
+        utils::U8x16::splat(static_cast<u8>(utils::DOUBLE_QUOTE));
+    const utils::U8x16 slash =
+        utils::U8x16::splat(static_cast<u8>(utils::BACKSLASH));
+    const utils::U8x16 control = utils::U8x16::splat(JSON_CONTROL_END);
+    const utils::U8x16 zero    = utils::U8x16::splat(0);
+
+    JsonBlock          block{};
+
+    for (usize lane = 0; lane < JSON_BLOCK_LANES; ++lane) {
+        const utils::U8x16 in =
+            utils::U8x16::load(ptr + (lane * utils::SIMD_WIDTH));
+        const usize shift = lane * utils::SIMD_WIDTH;
+
+        const utils::U8x16 op =
+            in.eq(utils::U8x16::splat(utils::BRACE_OPEN))
+                .bitOr(in.eq(utils::U8x16::splat(utils::BRACE_CLOSE)))
+                .bitOr(in.eq(utils::U8x16::splat(utils::BRACKET_OPEN)))
+                .bitOr(in.eq(utils::U8x16::splat(utils::BRACKET_CLOSE)))
+                .bitOr(in.eq(utils::U8x16::splat(utils::COLON)))
+                .bitOr(in.eq(utils::U8x16::splat(utils::COMMA)));
+        const utils::U8x16 space =
+            in.eq(utils::U8x16::splat(utils::SPACE))
+                .bitOr(in.eq(utils::U8x16::splat(utils::HT)))
+                .bitOr(in.eq(utils::U8x16::splat(utils::LF)))
+                .bitOr(in.eq(utils::U8x16::splat(utils::CR)));
+
+        // Lanes below 0x20 survive the saturating subtraction.
+        const u32 below = control.subSat(in).eq(zero).mask() ^ U16_MAX;
+
+        block.backslash |= u64{ in.eq(slash).mask() } << shift;
+        block.quote     |= u64{ in.eq(quote).mask() } << shift;
+        block.op        |= u64{ op.mask() } << shift;
+        block.space     |= u64{ space.mask() } << shift;
+        block.control   |= u64{ below } << shift;
+    }
+
+    return block;
+}
+
+constexpr u64 prefixXor(u64 bits) noexcept {
+    for (u32 shift = 1; shift < JSON_BLOCK; shift <<= 1U) bits ^= bits << shift;
+    return bits;
+}
+
+inline usize indexFault(std::string_view text, Err err) noexcept {
+    if (err == Err::INVALID_UTF8) return utils::findInvalidUtf8(text);
+    if (err != Err::JSON_BAD_TOKEN) return 0;
+
+    // A raw control character in a string, escaped or not, or else the
+    // opening quote of the string left unterminated.
+    bool  in_string = false;
+    usize opening   = 0;
+
+    for (usize pos = 0; pos < text.size(); ++pos) {
+        const char chr = text[pos];
+
+        if (!in_string) {
+            in_string = chr == utils::DOUBLE_QUOTE;
+            opening   = pos;
+        } else if (static_cast<u8>(chr) < JSON_CONTROL_END) {
+            return pos;
+        } else if (chr == utils::DOUBLE_QUOTE) {
+            in_string = false;
+        } else if (chr == utils::BACKSLASH && pos + 1 < text.size()) {
+            if (static_cast<u8>(text[pos + 1]) < JSON_CONTROL_END)
+                return pos + 1;
+
+            ++pos;
+        }
+    }
+
+    return in_string ? opening : text.size();
+}
+
+} // namespace impl
+
+// StructuralIndex ---
+
+inline StructuralIndex::StructuralIndex() noexcept :
+    positions_{},
+    size_{ 0 },
+    text_{} {}
+
+inline StructuralIndex::StructuralIndex(StructuralIndex &&index) noexcept :
+    positions_{ std::move(index.positions_) },
+    size_{ std::exchange(index.size_, 0) },
+    text_{ index.text_ } {}
+
+inline Status StructuralIndex::build(std::string_view text) noexcept {
+    size_ = 0;
+    text_ = text;
+
+    if (text.size() >= U32_MAX) return Err::CAPACITY_EXCEEDED;
+
+    // At most one structural per byte, the block write-out may overshoot by
+    // a block and the sentinel takes one more.
+    const Status reserved =
+        positions_.reserve(text.size() + impl::JSON_BLOCK + 1);
+    if (reserved.bad()) return reserved;
+
+    utils::impl::Utf8Checker checker = utils::impl::Utf8Checker::make();
+    impl::JsonScanner        scan{};
+
+    u32                     *out   = positions_.data();
+    const char              *ptr   = text.data();
+    const usize              len   = text.size();
+    u64                      fault = 0;
+
+    std::array<char, impl::JSON_BLOCK> tail{};
+
+    for (usize pos = 0; pos < len; pos += impl::JSON_BLOCK) {
+        const char *block = ptr + pos;
+
+        // The tail is padded with spaces, which are neither structural nor
+        // part of a scalar.
+        if (len - pos < impl::JSON_BLOCK) {
+            tail.fill(utils::SPACE);
+            std::memcpy(tail.data(), block, len - pos);
+            block = tail.data();
+        }
+
+        for (usize lane = 0; lane < impl::JSON_BLOCK_LANES; ++lane)
+            checker.push(
+                utils::U8x16::load(block + (lane * utils::SIMD_WIDTH)));
+
+        const impl::JsonBlock chars = impl::classifyBlock(block);
+
+        // A backslash escapes the next byte unless it is escaped itself,
+        // odd-length runs escape the byte after them.
+        const u64 backslash = chars.backslash & ~scan.escaped;
+        const u64 starts    = backslash << 1U;
+        const u64 codes =
+            ((starts | impl::JSON_ODD_BITS) - backslash) ^ impl::JSON_ODD_BITS;
+        const u64 escaped = codes ^ (chars.backslash | scan.escaped);
+        scan.escaped      = (codes & backslash) >> impl::JSON_LAST_BIT;
+
+        const u64 quote   = chars.quote & ~escaped;
+        const u64 strings = impl::prefixXor(quote) ^ scan.in_string;
+        scan.in_string    = static_cast<u64>(
+            static_cast<i64>(strings) >> impl::JSON_LAST_BIT);
+
+        // Inside strings, excluding the opening and including the closing
+        // quote.
+        const u64 tail_mask = strings ^ quote;
+
+        // Quotes always start a token, other scalars only after a byte that
+        // is not part of one.
+        const u64 bare      = ~(chars.op | chars.space | quote);
+        const u64 follows   = (bare << 1U) | scan.scalar;
+        scan.scalar         = bare >> impl::JSON_LAST_BIT;
+
+        const u64 starts_at =
+            (chars.op | quote | (bare & ~follows)) & ~tail_mask;
+
+        fault |= chars.control & strings;
+
+        u64 bits = starts_at;
+        while (bits != 0) {
+            *out++ = static_cast<u32>(pos) +
+                     static_cast<u32>(std::countr_zero(bits));
+            bits &= bits - 1;
+        }
+    }
+
+    if (checker.failed()) return Err::INVALID_UTF8;
+    if (fault != 0 || scan.in_string != 0) return Err::JSON_BAD_TOKEN;
+
+    size_  = static_cast<usize>(out - positions_.data());
+    *out   = static_cast<u32>(len);
+
+    return {};
+}
+
+inline std::string_view StructuralIndex::text() const noexcept { return text_; }
+
+inline usize            StructuralIndex::size() const noexcept { return size_; }
+
+inline std::span<const u32> StructuralIndex::positions() const noexcept {
+    return { positions_.data(), size_ + 1 };
+}
+
+inline char StructuralIndex::peek(usize cursor) const noexcept {
+    if (cursor >= size_) return utils::NUL;
+
+    return text_[positions_.data()[cursor]];
+}
+
+inline std::string_view StructuralIndex::token(usize cursor) const noexcept {
+    if (cursor >= size_) return {};
+
+    const usize first = positions_.data()[cursor];
+    usize       last  = positions_.data()[cursor + 1];
+    while (last > first && impl::isSpace(text_[last - 1])) --last;
+
+    return text_.substr(first, last - first);
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_INDEX_HPP
@@ -0,0 +1,283 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_INGEST_HPP
+#define SRR_JSON_INGEST_HPP
+
+#include "sierra/conc/jobs.hpp"
+#include "sierra/error.hpp"
+#include "sierra/fsys/file.hpp"
+#include "sierra/fsys/path.hpp"
+#include "sierra/json/parser.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+inline namespace srr {
+namespace json {
+
+// Called once per document with its root, returns what to keep of it. The
+// tape behind root is reused for the next document once body returns.
+template<typename F>
+concept IngestBody =
+    std::invocable<F &, const Element &> &&
+    std::same_as<std::invoke_result_t<F &, const Element &>,
+                 Result<typename std::invoke_result_t<F &, const Element &>::
+                            ValueType>>;
+
+template<IngestBody F>
+using IngestValue =
+    typename std::invoke_result_t<F &, const Element &>::ValueType;
+
+namespace impl {
+
+// Parser of one thread, claimed for a run of documents at a time.
+struct IngestState {
+    Parser            parser;
+    std::atomic<bool> busy;
+};
+
+} // namespace impl
+
+// Results of one Ingest::run(), one per input path in input order.
+template<ResultStorable T>
+class IngestResults {
+public:
+    [[nodiscard]] IngestResults(IngestResults &&results) noexcept;
+
+    IngestResults(const IngestResults &results)            = delete;
+    IngestResults &operator=(const IngestResults &results) = delete;
+    IngestResults &operator=(IngestResults &&results)      = delete;
+
+    ~IngestResults() noexcept;
+
+    [[nodiscard]] usize            size() const noexcept;
+
+    [[nodiscard]] Result<T>       &operator[](usize idx) noexcept;
+    [[nodiscard]] const Result<T> &operator[](usize idx) const noexcept;
+
+    [[nodiscard]] const Result<T> *begin() const noexcept;
+    [[nodiscard]] const Result<T> *end() const noexcept;
+
+private:
+    friend class Ingest;
+
+    // Takes ownership of size constructed results.
+    [[nodiscard]] IngestResults(Result<T> *data, usize size) noexcept;
+
+    Result<T> *data_;
+    usize      size_;
+};
+
+// Maps and parses many files on a JobSystem. Each file is mapped rather than
+// read so its bytes go straight from the page cache into the parser, and each
+// thread parses with a Parser kept here, whose buffers stay warm across runs
+// instead of growing again for every file.
+//
+// run() is safe to call from several threads at once, each with its own
+// context. A job that finds every parser taken, which only happens when
+// more threads help than the system has, parses with a temporary one.
+class Ingest {
+public:
+    [[nodiscard]] explicit Ingest(conc::JobSystem &system) noexcept;
+
+    Ingest(const Ingest &ingest)            = delete;
+    Ingest(Ingest &&ingest)                 = delete;
+    Ingest &operator=(const Ingest &ingest) = delete;
+    Ingest &operator=(Ingest &&ingest)      = delete;
+
+    ~Ingest() noexcept;
+
+    // Parses every file in paths and passes its root to body, concurrently
+    // from several threads. A file that cannot be opened, mapped or parsed
+    // gets that error as its result and does not stop the others. Fails
+    // with OUT_OF_MEMORY only when the results cannot be allocated.
+    template<IngestBody F>
+    [[nodiscard]] Result<IngestResults<IngestValue<F>>>
+    run(conc::JobContext            &ctx,
+        std::span<const fsys::Path> paths,
+        F                         &&body) noexcept;
+
+private:
+    [[nodiscard]] impl::IngestState *claim() noexcept;
+    void                             release(impl::IngestState *state) noexcept;
+
+    template<IngestBody F>
+    [[nodiscard]] static Result<IngestValue<F>> parse(
+        Parser           &parser,
+        const fsys::Path &path,
+        F                &body) noexcept;
+
+    impl::IngestState *states_;
+    usize              count_;
+};
+
+// IngestResults ---
+
+template<ResultStorable T>
+IngestResults<T>::IngestResults(Result<T> *data, usize size) noexcept :
+    data_{ data },
+    size_{ size } {}
+
+template<ResultStorable T>
+IngestResults<T>::IngestResults(IngestResults &&results) noexcept :
+    data_{ std::exchange(results.data_, nullptr) },
+    size_{ std::exchange(results.size_, 0) } {}
+
+template<ResultStorable T>
+IngestResults<T>::~IngestResults() noexcept {
+    std::destroy_n(data_, size_);
+    ::operator delete(data_, std::align_val_t{ alignof(Result<T>) });
+}
+
+template<ResultStorable T>
+usize IngestResults<T>::size() const noexcept {
+    return size_;
+}
+
+template<ResultStorable T>
+Result<T> &IngestResults<T>::operator[](usize idx) noexcept {
+    return data_[idx];
+}
+
+template<ResultStorable T>
+const Result<T> &IngestResults<T>::operator[](usize idx) const noexcept {
+    return data_[idx];
+}
+
+template<ResultStorable T>
+const Result<T> *IngestResults<T>::begin() const noexcept {
+    return data_;
+}
+
+template<ResultStorable T>
+const Result<T> *IngestResults<T>::end() const noexcept {
+    return data_ + size_;
+}
+
+// Ingest ---
+
+inline Ingest::Ingest(conc::JobSystem &system) noexcept :
+    states_{ static_cast<impl::IngestState *>(
+        ::operator new((system.workers() + 1) * sizeof(impl::IngestState),
+                       std::align_val_t{ alignof(impl::IngestState) },
+                       std::nothrow)) },
+    count_{ states_ != nullptr ? system.workers() + 1 : 0 } {
+    for (usize i = 0; i < count_; ++i) std::construct_at(states_ + i);
+}
+
+inline Ingest::~Ingest() noexcept {
+    std::destroy_n(states_, count_);
+    ::operator delete(states_, std::align_val_t{ alignof(impl::IngestState) });
+}
+
+template<IngestBody F>
+Result<IngestResults<IngestValue<F>>> Ingest::run(
+    conc::JobContext            &ctx,
+    std::span<const fsys::Path> paths,
+    F                         &&body) noexcept {
+    using Value = Result<IngestValue<F>>;
+
+    Value *data = static_cast<Value *>(
+        ::operator new(paths.size() * sizeof(Value),
+                       std::align_val_t{ alignof(Value) },
+                       std::nothrow));
+    if (data == nullptr) return Err::OUT_OF_MEMORY;
+
+    // Every index is visited exactly once, so all results are constructed
+    // by the time parallelFor returns. A file is coarse enough work that
+    // each one may go to a different thread.
+    ctx.parallelFor(0, paths.size(), 1, [&](usize first, usize last) noexcept {
+        impl::IngestState *state = claim();
+
+        if (state != nullptr) {
+            for (usize i = first; i < last; ++i)
+                std::construct_at(data + i,
+                                  parse(state->parser, paths[i], body));
+
+            release(state);
+            return;
+        }
+
+        Parser parser;
+        for (usize i = first; i < last; ++i)
+            std::construct_at(data + i, parse(parser, paths[i], body));
+    });
+
+    return IngestResults<IngestValue<F>>{ data, paths.size() };
+}
+
+inline impl::IngestState *Ingest::claim() noexcept {
+    for (usize i = 0; i < count_; ++i) {
+        if (states_[i].busy.load(std::memory_order_relaxed)) continue;
+
+        // Acquire pairs with the release in release() so the previous
+        // owner is done with the parser's buffers.
+        if (!states_[i].busy.exchange(true, std::memory_order_acquire))
+            return states_ + i;
+    }
+
+    return nullptr;
+}
+
+inline void Ingest::release(impl::IngestState *state) noexcept {
+    state->busy.store(false, std::memory_order_release);
+}
+
+template<IngestBody F>
+Result<IngestValue<F>> Ingest::parse(Parser           &parser,
+                                     const fsys::Path &path,
+                                     F                &body) noexcept {
+    const Result<fsys::File> file = fsys::openFile(path);
+    if (file.bad()) return file.err();
+
+    const Result<fsys::FileMap> map = file.val().map();
+    if (map.bad()) return map.err();
+
+    const std::span<const char> text     = map.val().data();
+    const Result<Document>      document =
+        parser.parse(std::string_view{ text.data(), text.size() });
+    if (document.bad()) return document.err();
+
+    return std::invoke(body, document.val().root());
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_INGEST_HPP
@@ -0,0 +1,603 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_LAZY_HPP
+#define SRR_JSON_LAZY_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/json/index.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/char.hpp"
+
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+inline namespace srr {
+namespace json {
+
+class LazyDocument;
+class LazyParser;
+class LazyValue;
+
+namespace impl {
+
+// Cursor of an exhausted lazy range.
+constexpr usize LAZY_END = USIZE_MAX;
+
+// Lookups behind find() and at(), which cannot be friends themselves as
+// their Result<LazyValue> needs the complete type.
+struct LazyAccess;
+
+} // namespace impl
+
+struct LazyMember;
+
+class LazyIter;
+class LazyMemberIter;
+
+// Handle to one value of a LazyDocument, a cursor into its structural index.
+// Nothing is decoded until a getter asks for it, and a getter decodes only
+// the value's own token. Trivially copyable, valid as long as the document.
+class LazyValue {
+public:
+    // Decided by the first byte, malformed tokens are reported by the getters.
+    [[nodiscard]] Type                     type() const noexcept;
+
+    // Fails with JSON_BAD_CAST when the value is of another type,
+    // JSON_BAD_SUBTYPE when a number does not fit the requested one and
+    // JSON_BAD_TOKEN when the token is malformed.
+    [[nodiscard]] Result<bool>             getBool() const noexcept;
+    [[nodiscard]] Result<i64>              getI64() const noexcept;
+    [[nodiscard]] Result<u64>              getU64() const noexcept;
+    [[nodiscard]] Result<f64>              getF64() const noexcept;
+    [[nodiscard]] Result<Number>           getNumber() const noexcept;
+
+    // Strings without escapes are views into the input, others are
+    // unescaped once into the document's scratch buffer.
+    [[nodiscard]] Result<std::string_view> getString() const noexcept;
+
+    // Counts the children by walking them, zero for scalars. Stops at the
+    // first malformed separator like the ranges.
+    [[nodiscard]] usize                    size() const noexcept;
+
+    // Both ranges are empty for values of another type. They end early at
+    // the first malformed separator, with the reason in the status() of the
+    // iterator that reached the end.
+    [[nodiscard]] LazyIter                 begin() const noexcept;
+    [[nodiscard]] LazyIter                 end() const noexcept;
+    [[nodiscard]] LazyMemberIter           membersBegin() const noexcept;
+    [[nodiscard]] LazyMemberIter           membersEnd() const noexcept;
+
+private:
+    friend class LazyDocument;
+    friend class LazyIter;
+    friend class LazyMemberIter;
+    friend struct impl::LazyAccess;
+
+    [[nodiscard]] LazyValue(LazyParser &parser, usize cursor) noexcept;
+
+    LazyParser *parser_;
+    usize       cursor_;
+};
+
+// The key is a string value, decoded on request like any other.
+struct LazyMember {
+    LazyValue key;
+    LazyValue value;
+};
+
+// Object member by key, skipping the values of the members before it
+// without decoding them. Fails with JSON_BAD_CAST when object is not one,
+// NO_SUCH_KEY, and the JSON_SYNTAX_* codes for malformed members on the way.
+[[nodiscard]] inline Result<LazyValue> find(const LazyValue &object,
+                                            std::string_view key) noexcept;
+
+// Array element by position, skipping the elements before it. Fails with
+// JSON_BAD_CAST when array is not one, INDEX_OUT_OF_RANGE, and the
+// JSON_SYNTAX_* codes for malformed separators on the way.
+[[nodiscard]] inline Result<LazyValue> at(const LazyValue &array,
+                                          usize            index) noexcept;
+
+class LazyIter {
+public:
+    [[nodiscard]] LazyValue operator*() const noexcept;
+    LazyIter               &operator++() noexcept;
+    [[nodiscard]] bool      operator==(const LazyIter &rhs) const noexcept;
+
+    // OK unless the range ended at a malformed separator, then
+    // JSON_SYNTAX_EXP_SEP or JSON_SYNTAX_EXP_VALUE. Only an iterator that
+    // reached the closing bracket with an OK status saw the whole array.
+    [[nodiscard]] Status    status() const noexcept;
+
+private:
+    friend class LazyValue;
+
+    [[nodiscard]] LazyIter(LazyParser          &parser,
+                           const Result<usize> &cursor) noexcept;
+
+    LazyParser *parser_;
+    usize       cursor_;
+    Err         fault_;
+};
+
+class LazyMemberIter {
+public:
+    [[nodiscard]] LazyMember operator*() const noexcept;
+    LazyMemberIter          &operator++() noexcept;
+    [[nodiscard]] bool operator==(const LazyMemberIter &rhs) const noexcept;
+
+    // As LazyIter::status(), also JSON_SYNTAX_EXP_KEY for a member that
+    // does not start with a key.
+    [[nodiscard]] Status     status() const noexcept;
+
+private:
+    friend class LazyValue;
+
+    [[nodiscard]] LazyMemberIter(LazyParser          &parser,
+                                 const Result<usize> &cursor) noexcept;
+
+    // cursor when it starts a "key": value member, LAZY_END for the
+    // closing brace.
+    [[nodiscard]] static Result<usize> checked(const LazyParser &parser,
+                                               usize cursor) noexcept;
+
+    LazyParser *parser_;
+    usize       cursor_;
+    Err         fault_;
+};
+
+// Document produced by LazyParser::parse(), valid until that parser parses
+// again or is destroyed. The input text must outlive it. Not thread-safe,
+// reading escaped strings writes the shared scratch buffer.
+class LazyDocument {
+public:
+    [[nodiscard]] LazyValue root() const noexcept;
+
+private:
+    friend class LazyParser;
+
+    [[nodiscard]] explicit LazyDocument(LazyParser &parser) noexcept;
+
+    LazyParser *parser_;
+};
+
+// On-demand parser, builds only the structural index up front and leaves
+// every value to be located and decoded when it is read. Skipping a value
+// counts brackets over the index, so untouched subtrees cost one pass over
+// their structurals and no allocation. Memory is the index plus, once an
+// escaped string is read, a scratch buffer the size of the input.
+//
+// Only the parts that are read are validated beyond stage one, use Parser
+// when the whole document must be checked.
+class LazyParser {
+public:
+    [[nodiscard]] LazyParser() noexcept;
+    [[nodiscard]] LazyParser(LazyParser &&parser) noexcept;
+
+    LazyParser(const LazyParser &parser)            = delete;
+    LazyParser &operator=(const LazyParser &parser) = delete;
+    LazyParser &operator=(LazyParser &&parser)      = delete;
+
+    ~LazyParser() noexcept                          = default;
+
+    // Fails with the StructuralIndex errors, JSON_SYNTAX_EXP_VALUE for empty
+    // input and JSON_SYNTAX_DBL_ROOT when more follows the root value.
+    [[nodiscard]] Result<LazyDocument> parse(std::string_view text) noexcept;
+
+private:
+    friend class LazyValue;
+    friend class LazyIter;
+    friend class LazyMemberIter;
+    friend struct impl::LazyAccess;
+
+    // Cursor after the value at cursor, containers are skipped whole.
+    // LAZY_END when a container is never closed.
+    [[nodiscard]] usize                    skip(usize cursor) const noexcept;
+
+    // Cursor of the value after the one at cursor in its container,
+    // LAZY_END past close. Fails with JSON_SYNTAX_EXP_SEP when neither a
+    // comma nor close follows the value.
+    [[nodiscard]] Result<usize> next(usize cursor, char close) const noexcept;
+
+    // cursor when it starts a value, JSON_SYNTAX_EXP_VALUE otherwise.
+    [[nodiscard]] Result<usize> value(usize cursor) const noexcept;
+
+    [[nodiscard]] Result<std::string_view> string(usize cursor) noexcept;
+
+    StructuralIndex                        index_;
+    impl::JsonBuffer<char>                 scratch_;
+};
+
+namespace impl {
+
+struct LazyAccess {
+    [[nodiscard]] static Result<LazyValue> find(const LazyValue &object,
+                                                std::string_view key) noexcept;
+    [[nodiscard]] static Result<LazyValue> at(const LazyValue &array,
+                                              usize            index) noexcept;
+};
+
+} // namespace impl
+
+// LazyValue ---
+
+inline LazyValue::LazyValue(LazyParser &parser, usize cursor) noexcept :
+    parser_{ &parser },
+    cursor_{ cursor } {}
+
+inline Type LazyValue::type() const noexcept {
+    switch (parser_->index_.peek(cursor_)) {
+    case utils::BRACE_OPEN  : return Type::OBJECT;
+    case utils::BRACKET_OPEN: return Type::ARRAY;
+    case utils::DOUBLE_QUOTE: return Type::STRING;
+    case utils::T           : [[fallthrough]];
+    case utils::F           : return Type::BOOL;
+    case utils::N           : return Type::NUL;
+    default                 : break;
+    }
+
+    return Type::NUMBER;
+}
+
+inline Result<bool> LazyValue::getBool() const noexcept {
+    if (type() != Type::BOOL) return Err::JSON_BAD_CAST;
+
+    const std::string_view token = parser_->index_.token(cursor_);
+    if (token == "true") return true;
+    if (token == "false") return false;
+
+    return Err::JSON_BAD_TOKEN;
+}
+
+inline Result<i64> LazyValue::getI64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<i64>(number.val());
+}
+
+inline Result<u64> LazyValue::getU64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<u64>(number.val());
+}
+
+inline Result<f64> LazyValue::getF64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<f64>(number.val());
+}
+
+inline Result<Number> LazyValue::getNumber() const noexcept {
+    if (type() != Type::NUMBER) return Err::JSON_BAD_CAST;
+
+    return impl::readNumber(parser_->index_.token(cursor_));
+}
+
+inline Result<std::string_view> LazyValue::getString() const noexcept {
+    if (type() != Type::STRING) return Err::JSON_BAD_CAST;
+
+    return parser_->string(cursor_);
+}
+
+inline usize LazyValue::size() const noexcept {
+    usize count = 0;
+    if (type() == Type::OBJECT) {
+        for (LazyMemberIter iter = membersBegin(); iter != membersEnd(); ++iter)
+            ++count;
+    } else {
+        for (LazyIter iter = begin(); iter != end(); ++iter) ++count;
+    }
+
+    return count;
+}
+
+inline LazyIter LazyValue::begin() const noexcept {
+    if (type() != Type::ARRAY ||
+        parser_->index_.peek(cursor_ + 1) == utils::BRACKET_CLOSE)
+        return end();
+
+    return { *parser_, parser_->value(cursor_ + 1) };
+}
+
+inline LazyIter LazyValue::end() const noexcept {
+    return { *parser_, impl::LAZY_END };
+}
+
+inline LazyMemberIter LazyValue::membersBegin() const noexcept {
+    if (type() != Type::OBJECT ||
+        parser_->index_.peek(cursor_ + 1) == utils::BRACE_CLOSE)
+        return membersEnd();
+
+    return { *parser_, LazyMemberIter::checked(*parser_, cursor_ + 1) };
+}
+
+inline LazyMemberIter LazyValue::membersEnd() const noexcept {
+    return { *parser_, impl::LAZY_END };
+}
+
+inline Result<LazyValue> find(const LazyValue &object,
+                              std::string_view key) noexcept {
+    return impl::LazyAccess::find(object, key);
+}
+
+inline Result<LazyValue> at(const LazyValue &array, usize index) noexcept {
+    return impl::LazyAccess::at(array, index);
+}
+
+// LazyAccess ---
+
+inline Result<LazyValue> impl::LazyAccess::find(const LazyValue &object,
+                                                std::string_view key) noexcept {
+    if (object.type() != Type::OBJECT) return Err::JSON_BAD_CAST;
+
+    LazyParser            &parser = *object.parser_;
+    const StructuralIndex &index  = parser.index_;
+
+    usize                  cursor = object.cursor_ + 1;
+    if (index.peek(cursor) == utils::BRACE_CLOSE) return Err::NO_SUCH_KEY;
+
+    while (true) {
+        if (index.peek(cursor) != utils::DOUBLE_QUOTE)
+            return Err::JSON_SYNTAX_EXP_KEY;
+        if (index.peek(cursor + 1) != utils::COLON)
+            return Err::JSON_SYNTAX_EXP_SEP;
+
+        const Result<std::string_view> name = parser.string(cursor);
+        if (name.bad()) return name.err();
+
+        const usize value = cursor + 2;
+        if (impl::isOperator(index.peek(value)) &&
+            index.peek(value) != utils::BRACE_OPEN &&
+            index.peek(value) != utils::BRACKET_OPEN)
+            return Err::JSON_SYNTAX_EXP_VALUE;
+
+        if (name.val() == key) return LazyValue{ parser, value };
+
+        cursor = parser.skip(value);
+        switch (index.peek(cursor)) {
+        case utils::COMMA      : ++cursor; break;
+        case utils::BRACE_CLOSE: return Err::NO_SUCH_KEY;
+        default                : return Err::JSON_SYNTAX_EXP_SEP;
+        }
+    }
+}
+
+inline Result<LazyValue> impl::LazyAccess::at(const LazyValue &array,
+                                              usize            index) noexcept {
+    if (array.type() != Type::ARRAY) return Err::JSON_BAD_CAST;
+
+    LazyParser            &parser     = *array.parser_;
+    const StructuralIndex &structural = parser.index_;
+
+    usize                  cursor     = array.cursor_ + 1;
+    if (structural.peek(cursor) == utils::BRACKET_CLOSE)
+        return Err::INDEX_OUT_OF_RANGE;
+
+    for (usize seen = 0;; ++seen) {
+        const char chr = structural.peek(cursor);
+        if (impl::isOperator(chr) && chr != utils::BRACE_OPEN &&
+            chr != utils::BRACKET_OPEN)
+            return Err::JSON_SYNTAX_EXP_VALUE;
+
+        if (seen == index) return LazyValue{ parser, cursor };
+
+        cursor = parser.skip(cursor);
+        switch (structural.peek(cursor)) {
+        case utils::COMMA        : ++cursor; break;
+        case utils::BRACKET_CLOSE: return Err::INDEX_OUT_OF_RANGE;
+        default                  : return Err::JSON_SYNTAX_EXP_SEP;
+        }
+    }
+}
+
+// LazyIter ---
+
+inline LazyIter::LazyIter(LazyParser          &parser,
+                          const Result<usize> &cursor) noexcept :
+    parser_{ &parser },
+    cursor_{ cursor.ok() ? cursor.val() : impl::LAZY_END },
+    fault_{ cursor.ok() ? Err::OK : cursor.err() } {}
+
+inline LazyValue LazyIter::operator*() const noexcept {
+    return { *parser_, cursor_ };
+}
+
+inline LazyIter &LazyIter::operator++() noexcept {
+    const Result<usize> next = parser_->next(cursor_, utils::BRACKET_CLOSE);
+
+    if (next.ok() && next.val() != impl::LAZY_END)
+        *this = LazyIter{ *parser_, parser_->value(next.val()) };
+    else
+        *this = LazyIter{ *parser_, next };
+
+    return *this;
+}
+
+inline bool LazyIter::operator==(const LazyIter &rhs) const noexcept {
+    return cursor_ == rhs.cursor_;
+}
+
+inline Status LazyIter::status() const noexcept { return fault_; }
+
+// LazyMemberIter ---
+
+inline LazyMemberIter::LazyMemberIter(LazyParser          &parser,
+                                      const Result<usize> &cursor) noexcept :
+    parser_{ &parser },
+    cursor_{ cursor.ok() ? cursor.val() : impl::LAZY_END },
+    fault_{ cursor.ok() ? Err::OK : cursor.err() } {}
+
+inline LazyMember LazyMemberIter::operator*() const noexcept {
+    return {
+        .key   = LazyValue{ *parser_, cursor_ },
+        .value = LazyValue{ *parser_, cursor_ + 2 },
+    };
+}
+
+inline LazyMemberIter &LazyMemberIter::operator++() noexcept {
+    const Result<usize> next = parser_->next(cursor_ + 2, utils::BRACE_CLOSE);
+
+    if (next.ok() && next.val() != impl::LAZY_END)
+        *this = LazyMemberIter{ *parser_, checked(*parser_, next.val()) };
+    else
+        *this = LazyMemberIter{ *parser_, next };
+
+    return *this;
+}
+
+inline bool LazyMemberIter::operator==(
+    const LazyMemberIter &rhs) const noexcept {
+    return cursor_ == rhs.cursor_;
+}
+
+inline Status LazyMemberIter::status() const noexcept { return fault_; }
+
+inline Result<usize> LazyMemberIter::checked(const LazyParser &parser,
+                                             usize cursor) noexcept {
+    if (parser.index_.peek(cursor) != utils::DOUBLE_QUOTE)
+        return Err::JSON_SYNTAX_EXP_KEY;
+    if (parser.index_.peek(cursor + 1) != utils::COLON)
+        return Err::JSON_SYNTAX_EXP_SEP;
+
+    const Result<usize> value = parser.value(cursor + 2);
+    if (value.bad()) return value.err();
+
+    return cursor;
+}
+
+// LazyDocument ---
+
+inline LazyDocument::LazyDocument(LazyParser &parser) noexcept :
+    parser_{ &parser } {}
+
+inline LazyValue LazyDocument::root() const noexcept { return { *parser_, 0 }; }
+
+// LazyParser ---
+
+inline LazyParser::LazyParser() noexcept : index_{}, scratch_{} {}
+
+inline LazyParser::LazyParser(LazyParser &&parser) noexcept :
+    index_{ std::move(parser.index_) },
+    scratch_{ std::move(parser.scratch_) } {}
+
+inline Result<LazyDocument> LazyParser::parse(std::string_view text) noexcept {
+    const Status indexed = index_.build(text);
+    if (indexed.bad()) return indexed.err();
+
+    if (index_.size() == 0) return Err::JSON_SYNTAX_EXP_VALUE;
+
+    // A container that is never closed is cut off, not a shorter root.
+    const usize end = skip(0);
+    if (end == impl::LAZY_END) return Err::JSON_SYNTAX_EXP_SEP;
+    if (end != index_.size()) return Err::JSON_SYNTAX_DBL_ROOT;
+
+    return LazyDocument{ *this };
+}
+
+inline usize LazyParser::skip(usize cursor) const noexcept {
+    const char chr = index_.peek(cursor);
+    if (chr != utils::BRACE_OPEN && chr != utils::BRACKET_OPEN)
+        return cursor + 1;
+
+    // Brackets inside strings are not structurals, so counting them is
+    // enough. Mismatched pairs are left for the accessors and iterators to
+    // report.
+    usize depth = 0;
+    for (; cursor < index_.size(); ++cursor) {
+        switch (index_.peek(cursor)) {
+        case utils::BRACE_OPEN   : [[fallthrough]];
+        case utils::BRACKET_OPEN : ++depth; break;
+        case utils::BRACE_CLOSE  : [[fallthrough]];
+        case utils::BRACKET_CLOSE: --depth; break;
+        default                  : break;
+        }
+
+        if (depth == 0) return cursor + 1;
+    }
+
+    return impl::LAZY_END;
+}
+
+inline Result<usize> LazyParser::next(usize cursor, char close) const noexcept {
+    const usize after = skip(cursor);
+    const char  chr   = index_.peek(after);
+
+    if (chr == utils::COMMA) return after + 1;
+    if (chr == close) return impl::LAZY_END;
+
+    return Err::JSON_SYNTAX_EXP_SEP;
+}
+
+inline Result<usize> LazyParser::value(usize cursor) const noexcept {
+    const char chr = index_.peek(cursor);
+    if (chr == utils::NUL || (impl::isOperator(chr) &&
+                              chr != utils::BRACE_OPEN &&
+                              chr != utils::BRACKET_OPEN))
+        return Err::JSON_SYNTAX_EXP_VALUE;
+
+    return cursor;
+}
+
+inline Result<std::string_view> LazyParser::string(usize cursor) noexcept {
+    const std::string_view token = index_.token(cursor);
+    if (token.size() < 2 || token.back() != utils::DOUBLE_QUOTE)
+        return Err::JSON_BAD_TOKEN;
+
+    const std::string_view body = token.substr(1, token.size() - 2);
+    if (std::memchr(body.data(), utils::BACKSLASH, body.size()) == nullptr)
+        return body;
+
+    // An unescaped string is never longer than its source, so each one is
+    // written at its own input offset. Views stay valid while others are
+    // decoded and reading a string twice rewrites the same bytes. Bounding
+    // the source at the closing quote keeps the block copies inside it.
+    const Status reserved = scratch_.reserve(index_.text().size());
+    if (reserved.bad()) return reserved.err();
+
+    const usize                    offset = index_.positions()[cursor] + 1;
+    char                          *dst    = scratch_.data() + offset;
+
+    const Result<impl::StringScan> scan   = impl::unescapeString(
+        body.data(), body.data() + body.size() + 1, dst);
+    if (scan.bad()) return scan.err();
+
+    return std::string_view{ dst, scan.val().length };
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_LAZY_HPP
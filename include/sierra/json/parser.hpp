@@ -0,0 +1,724 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_PARSER_HPP
+#define SRR_JSON_PARSER_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/json/index.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/char.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+
+inline namespace srr {
+namespace json {
+
+class Document;
+class Element;
+class Parser;
+
+namespace impl {
+
+// Tape words hold a tag in the top byte and a payload below it. Numbers
+// take a second word with the raw bits, containers store the index past
+// their END word and a saturated child count, END stores its opener and
+// strings the offset of their length prefix in the string buffer.
+enum class TapeTag : u8 {
+    NUL = 0,
+    TRUE,
+    FALSE,
+    INT,
+    UINT,
+    FLOAT,
+    STRING,
+    ARRAY,
+    OBJECT,
+    END,
+};
+
+constexpr u32   TAPE_TAG_SHIFT   = 56;
+constexpr u64   TAPE_PAYLOAD     = (u64{ 1 } << TAPE_TAG_SHIFT) - 1;
+constexpr u32   TAPE_COUNT_SHIFT = 32;
+constexpr u64   TAPE_COUNT_MAX   = (u64{ 1 } << (TAPE_TAG_SHIFT -
+                                                TAPE_COUNT_SHIFT)) -
+                                 1;
+
+constexpr usize JSON_LENGTH_SIZE = sizeof(u32);
+
+struct TapeScope {
+    u32 begin;
+    u32 count;
+};
+
+[[nodiscard]] constexpr u64     tapeWord(TapeTag tag, u64 payload) noexcept;
+[[nodiscard]] constexpr TapeTag tapeTag(u64 word) noexcept;
+[[nodiscard]] constexpr u64     tapePayload(u64 word) noexcept;
+
+// Index of the word after the value starting at word.
+[[nodiscard]] constexpr usize   tapeSkip(std::span<const u64> tape,
+                                         usize                word) noexcept;
+
+} // namespace impl
+
+struct Member;
+
+class ElementIter;
+class MemberIter;
+
+// Read-only view of one value on a Document tape, trivially copyable.
+class Element {
+public:
+    [[nodiscard]] Type                     type() const noexcept;
+
+    // Fails with JSON_BAD_CAST when the element is of another type and with
+    // JSON_BAD_SUBTYPE when a number does not fit the requested one.
+    [[nodiscard]] Result<bool>             getBool() const noexcept;
+    [[nodiscard]] Result<i64>              getI64() const noexcept;
+    [[nodiscard]] Result<u64>              getU64() const noexcept;
+    [[nodiscard]] Result<f64>              getF64() const noexcept;
+    [[nodiscard]] Result<Number>           getNumber() const noexcept;
+    [[nodiscard]] Result<std::string_view> getString() const noexcept;
+
+    // Children of an array or object, zero for anything else.
+    [[nodiscard]] usize                    size() const noexcept;
+
+    // Both ranges are empty for elements of another type.
+    [[nodiscard]] ElementIter              begin() const noexcept;
+    [[nodiscard]] ElementIter              end() const noexcept;
+    [[nodiscard]] MemberIter               membersBegin() const noexcept;
+    [[nodiscard]] MemberIter               membersEnd() const noexcept;
+
+private:
+    friend class Document;
+    friend class ElementIter;
+    friend class MemberIter;
+
+    [[nodiscard]] Element(const Document &doc, usize word) noexcept;
+
+    [[nodiscard]] impl::TapeTag tag() const noexcept;
+
+    const Document *doc_;
+    usize           word_;
+};
+
+struct Member {
+    std::string_view key;
+    Element          value;
+};
+
+// Object member by key, a linear scan over the members. Fails with
+// JSON_BAD_CAST when object is not one and NO_SUCH_KEY.
+[[nodiscard]] inline Result<Element> find(const Element   &object,
+                                          std::string_view key) noexcept;
+
+// Array element by position. Fails with JSON_BAD_CAST when array is not one
+// and INDEX_OUT_OF_RANGE.
+[[nodiscard]] inline Result<Element> at(const Element &array,
+                                        usize          index) noexcept;
+
+class ElementIter {
+public:
+    [[nodiscard]] Element operator*() const noexcept;
+    ElementIter          &operator++() noexcept;
+    [[nodiscard]] bool    operator==(const ElementIter &rhs) const noexcept;
+
+private:
+    friend class Element;
+
+    [[nodiscard]] ElementIter(const Document &doc, usize word) noexcept;
+
+    const Document *doc_;
+    usize           word_;
+};
+
+class MemberIter {
+public:
+    [[nodiscard]] Member operator*() const noexcept;
+    MemberIter          &operator++() noexcept;
+    [[nodiscard]] bool   operator==(const MemberIter &rhs) const noexcept;
+
+private:
+    friend class Element;
+
+    [[nodiscard]] MemberIter(const Document &doc, usize word) noexcept;
+
+    const Document *doc_;
+    usize           word_;
+};
+
+// Parsed document, a view of the tape and string buffer of the Parser that
+// produced it. It stays valid until that parser parses again or is
+// destroyed, the input text may be released right after parsing.
+class Document {
+public:
+    [[nodiscard]] Element                root() const noexcept;
+    [[nodiscard]] std::span<const u64>   tape() const noexcept;
+
+private:
+    friend class Element;
+    friend class ElementIter;
+    friend class MemberIter;
+    friend class Parser;
+
+    [[nodiscard]] Document(std::span<const u64> tape,
+                           const char          *strings) noexcept;
+
+    [[nodiscard]] std::string_view string(usize word) const noexcept;
+
+    std::span<const u64> tape_;
+    const char          *strings_;
+};
+
+// Two-stage parser. Stage one builds the StructuralIndex, stage two walks
+// it once and writes a flat tape with numbers decoded and strings unescaped
+// into a side buffer, so a parse allocates nothing once the buffers are
+// warm. A parser is meant to be reused, one per thread.
+class Parser {
+public:
+    [[nodiscard]] Parser() noexcept;
+    [[nodiscard]] Parser(Parser &&parser) noexcept;
+
+    Parser(const Parser &parser)            = delete;
+    Parser &operator=(const Parser &parser) = delete;
+    Parser &operator=(Parser &&parser)      = delete;
+
+    ~Parser() noexcept                      = default;
+
+    // Fails with the JSON_SYNTAX_* codes on structure errors, JSON_BAD_TOKEN
+    // on malformed literals, numbers and strings, INVALID_UTF8, and
+    // CAPACITY_EXCEEDED past JSON_MAX_DEPTH levels of nesting.
+    [[nodiscard]] Result<Document> parse(std::string_view text) noexcept;
+
+    // Byte offset of the last failure of parse(), the input size when the
+    // input ended early and 0 for failures with no place in the text. Feed
+    // it to diagnose() for a line, column and snippet.
+    [[nodiscard]] usize            errorOffset() const noexcept;
+
+private:
+    enum class Expect : u8 {
+        VALUE = 0,
+        KEY,
+        NEXT,
+    };
+
+    [[nodiscard]] Status reserve() noexcept;
+    [[nodiscard]] Status buildTape(usize &cursor) noexcept;
+
+    [[nodiscard]] Status open(impl::TapeTag tag) noexcept;
+    void                 close() noexcept;
+    [[nodiscard]] Status scalar(usize cursor) noexcept;
+    [[nodiscard]] Status string(usize cursor) noexcept;
+
+    StructuralIndex                   index_;
+    impl::JsonBuffer<u64>             tape_;
+    impl::JsonBuffer<char>            strings_;
+    impl::JsonBuffer<impl::TapeScope> scopes_;
+    usize                             words_;
+    usize                             used_;
+    usize                             depth_;
+    usize                             fault_;
+};
+
+namespace impl {
+
+constexpr u64 tapeWord(TapeTag tag, u64 payload) noexcept {
+    return (static_cast<u64>(tag) << TAPE_TAG_SHIFT) | payload;
+}
+
+constexpr TapeTag tapeTag(u64 word) noexcept {
+    return static_cast<TapeTag>(word >> TAPE_TAG_SHIFT);
+}
+
+constexpr u64 tapePayload(u64 word) noexcept { return word & TAPE_PAYLOAD; }
+
+constexpr usize tapeSkip(std::span<const u64> tape, usize word) noexcept {
+    switch (tapeTag(tape[word])) {
+    case TapeTag::INT   : [[fallthrough]];
+    case TapeTag::UINT  : [[fallthrough]];
+    case TapeTag::FLOAT : return word + 2;
+    case TapeTag::ARRAY : [[fallthrough]];
+    case TapeTag::OBJECT: return tapePayload(tape[word]) & U32_MAX;
+    default             : return word + 1;
+    }
+}
+
+} // namespace impl
+
+// Element ---
+
+inline Element::Element(const Document &doc, usize word) noexcept :
+    doc_{ &doc },
+    word_{ word } {}
+
+inline impl::TapeTag Element::tag() const noexcept {
+    return impl::tapeTag(doc_->tape_[word_]);
+}
+
+inline Type Element::type() const noexcept {
+    switch (tag()) {
+    case impl::TapeTag::TRUE  : [[fallthrough]];
+    case impl::TapeTag::FALSE : return Type::BOOL;
+    case impl::TapeTag::INT   : [[fallthrough]];
+    case impl::TapeTag::UINT  : [[fallthrough]];
+    case impl::TapeTag::FLOAT : return Type::NUMBER;
+    case impl::TapeTag::STRING: return Type::STRING;
+    case impl::TapeTag::ARRAY : return Type::ARRAY;
+    case impl::TapeTag::OBJECT: return Type::OBJECT;
+    default                   : return Type::NUL;
+    }
+}
+
+inline Result<bool> Element::getBool() const noexcept {
+    switch (tag()) {
+    case impl::TapeTag::TRUE : return true;
+    case impl::TapeTag::FALSE: return false;
+    default                  : return Err::JSON_BAD_CAST;
+    }
+}
+
+inline Result<i64> Element::getI64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<i64>(number.val());
+}
+
+inline Result<u64> Element::getU64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<u64>(number.val());
+}
+
+inline Result<f64> Element::getF64() const noexcept {
+    const Result<Number> number = getNumber();
+    if (number.bad()) return number.err();
+
+    return impl::numberAs<f64>(number.val());
+}
+
+inline Result<Number> Element::getNumber() const noexcept {
+    const u64 bits = word_ + 1 < doc_->tape_.size() ? doc_->tape_[word_ + 1]
+                                                    : 0;
+
+    switch (tag()) {
+    case impl::TapeTag::INT:
+        return Number{ .type = NumberType::INT, .bits = bits };
+    case impl::TapeTag::UINT:
+        return Number{ .type = NumberType::UINT, .bits = bits };
+    case impl::TapeTag::FLOAT:
+        return Number{ .type = NumberType::FLOAT, .bits = bits };
+    default: return Err::JSON_BAD_CAST;
+    }
+}
+
+inline Result<std::string_view> Element::getString() const noexcept {
+    if (tag() != impl::TapeTag::STRING) return Err::JSON_BAD_CAST;
+
+    return doc_->string(word_);
+}
+
+inline usize Element::size() const noexcept {
+    const impl::TapeTag tag = this->tag();
+    if (tag != impl::TapeTag::ARRAY && tag != impl::TapeTag::OBJECT) return 0;
+
+    const u64 count = impl::tapePayload(doc_->tape_[word_]) >>
+                      impl::TAPE_COUNT_SHIFT;
+    if (count < impl::TAPE_COUNT_MAX) return count;
+
+    // Saturated, count the hard way.
+    usize total = 0;
+    for (ElementIter iter = begin(); iter != end(); ++iter) ++total;
+
+    return tag == impl::TapeTag::OBJECT ? total / 2 : total;
+}
+
+inline ElementIter Element::begin() const noexcept {
+    const impl::TapeTag tag = this->tag();
+    if (tag != impl::TapeTag::ARRAY && tag != impl::TapeTag::OBJECT)
+        return end();
+
+    return { *doc_, word_ + 1 };
+}
+
+inline ElementIter Element::end() const noexcept {
+    const impl::TapeTag tag = this->tag();
+    if (tag != impl::TapeTag::ARRAY && tag != impl::TapeTag::OBJECT)
+        return { *doc_, word_ };
+
+    // The END word sits right before the index stored in the opener.
+    return { *doc_, impl::tapeSkip(doc_->tape_, word_) - 1 };
+}
+
+inline MemberIter Element::membersBegin() const noexcept {
+    if (tag() != impl::TapeTag::OBJECT) return membersEnd();
+
+    return { *doc_, word_ + 1 };
+}
+
+inline MemberIter Element::membersEnd() const noexcept {
+    if (tag() != impl::TapeTag::OBJECT) return { *doc_, word_ };
+
+    return { *doc_, impl::tapeSkip(doc_->tape_, word_) - 1 };
+}
+
+inline Result<Element> find(const Element   &object,
+                            std::string_view key) noexcept {
+    if (object.type() != Type::OBJECT) return Err::JSON_BAD_CAST;
+
+    for (MemberIter iter = object.membersBegin(); iter != object.membersEnd();
+         ++iter) {
+        const Member member = *iter;
+        if (member.key == key) return member.value;
+    }
+
+    return Err::NO_SUCH_KEY;
+}
+
+inline Result<Element> at(const Element &array, usize index) noexcept {
+    if (array.type() != Type::ARRAY) return Err::JSON_BAD_CAST;
+
+    usize seen = 0;
+    for (const Element element : array) {
+        if (seen++ == index) return element;
+    }
+
+    return Err::INDEX_OUT_OF_RANGE;
+}
+
+// ElementIter ---
+
+inline ElementIter::ElementIter(const Document &doc, usize word) noexcept :
+    doc_{ &doc },
+    word_{ word } {}
+
+inline Element ElementIter::operator*() const noexcept {
+    return { *doc_, word_ };
+}
+
+inline ElementIter &ElementIter::operator++() noexcept {
+    word_ = impl::tapeSkip(doc_->tape_, word_);
+    return *this;
+}
+
+inline bool ElementIter::operator==(const ElementIter &rhs) const noexcept {
+    return word_ == rhs.word_;
+}
+
+// MemberIter ---
+
+inline MemberIter::MemberIter(const Document &doc, usize word) noexcept :
+    doc_{ &doc },
+    word_{ word } {}
+
+inline Member MemberIter::operator*() const noexcept {
+    return {
+        .key   = doc_->string(word_),
+        .value = Element{ *doc_, word_ + 1 },
+    };
+}
+
+inline MemberIter &MemberIter::operator++() noexcept {
+    word_ = impl::tapeSkip(doc_->tape_, word_ + 1);
+    return *this;
+}
+
+inline bool MemberIter::operator==(const MemberIter &rhs) const noexcept {
+    return word_ == rhs.word_;
+}
+
+// Document ---
+
+inline Document::Document(std::span<const u64> tape,
+                          const char          *strings) noexcept :
+    tape_{ tape },
+    strings_{ strings } {}
+
+inline Element Document::root() const noexcept { return { *this, 0 }; }
+
+inline std::span<const u64> Document::tape() const noexcept { return tape_; }
+
+inline std::string_view     Document::string(usize word) const noexcept {
+    const char *ptr    = strings_ + impl::tapePayload(tape_[word]);
+
+    u32         length = 0;
+    std::memcpy(&length, ptr, sizeof(length));
+
+    return { ptr + sizeof(length), length };
+}
+
+// Parser ---
+
+inline Parser::Parser() noexcept :
+    index_{},
+    tape_{},
+    strings_{},
+    scopes_{},
+    words_{ 0 },
+    used_{ 0 },
+    depth_{ 0 },
+    fault_{ 0 } {}
+
+inline Parser::Parser(Parser &&parser) noexcept :
+    index_{ std::move(parser.index_) },
+    tape_{ std::move(parser.tape_) },
+    strings_{ std::move(parser.strings_) },
+    scopes_{ std::move(parser.scopes_) },
+    words_{ 0 },
+    used_{ 0 },
+    depth_{ 0 },
+    fault_{ 0 } {}
+
+inline Result<Document> Parser::parse(std::string_view text) noexcept {
+    words_ = 0;
+    used_  = 0;
+    depth_ = 0;
+    fault_ = 0;
+
+    // Stage one keeps no positions for its faults, they are found again
+    // here so a successful build pays nothing for them.
+    const Status indexed = index_.build(text);
+    if (indexed.bad()) {
+        fault_ = impl::indexFault(text, indexed.err());
+        return indexed.err();
+    }
+
+    const Status reserved = reserve();
+    if (reserved.bad()) return reserved.err();
+
+    usize        cursor = 0;
+    const Status built  = buildTape(cursor);
+    if (built.bad()) {
+        fault_ = index_.positions()[std::min(cursor, index_.size())];
+        return built.err();
+    }
+
+    return Document{ { tape_.data(), words_ }, strings_.data() };
+}
+
+inline usize Parser::errorOffset() const noexcept { return fault_; }
+
+inline Status Parser::reserve() noexcept {
+    const usize structurals = index_.size();
+
+    // Every structural writes at most two words, every string at most its
+    // input bytes plus a length prefix.
+    const Status tape       = tape_.reserve((structurals * 2) + 1);
+    if (tape.bad()) return tape;
+
+    const Status strings = strings_.reserve(
+        index_.text().size() + (structurals * impl::JSON_LENGTH_SIZE) +
+        impl::JSON_STRING_SLACK);
+    if (strings.bad()) return strings;
+
+    return scopes_.reserve(impl::JSON_MAX_DEPTH);
+}
+
+inline Status Parser::buildTape(usize &cursor) noexcept {
+    const usize count  = index_.size();
+    Expect      expect = Expect::VALUE;
+
+    while (true) {
+        switch (expect) {
+        case Expect::VALUE: {
+            const char chr = index_.peek(cursor);
+
+            if (chr == utils::BRACE_OPEN || chr == utils::BRACKET_OPEN) {
+                const bool   object = chr == utils::BRACE_OPEN;
+                const Status opened = open(object ? impl::TapeTag::OBJECT
+                                                  : impl::TapeTag::ARRAY);
+                if (opened.bad()) return opened;
+
+                ++cursor;
+
+                const char closer =
+                    object ? utils::BRACE_CLOSE : utils::BRACKET_CLOSE;
+                if (index_.peek(cursor) == closer) {
+                    ++cursor;
+                    close();
+                    expect = Expect::NEXT;
+                } else {
+                    expect = object ? Expect::KEY : Expect::VALUE;
+                }
+                break;
+            }
+
+            const Status value = scalar(cursor);
+            if (value.bad()) return value;
+
+            ++cursor;
+            expect = Expect::NEXT;
+            break;
+        }
+
+        case Expect::KEY: {
+            if (index_.peek(cursor) != utils::DOUBLE_QUOTE)
+                return Err::JSON_SYNTAX_EXP_KEY;
+
+            const Status key = string(cursor);
+            if (key.bad()) return key;
+
+            ++cursor;
+            if (index_.peek(cursor) != utils::COLON)
+                return Err::JSON_SYNTAX_EXP_SEP;
+
+            ++cursor;
+            expect = Expect::VALUE;
+            break;
+        }
+
+        case Expect::NEXT: {
+            if (depth_ == 0) {
+                if (cursor < count) return Err::JSON_SYNTAX_DBL_ROOT;
+                return {};
+            }
+
+            impl::TapeScope &scope = scopes_.data()[depth_ - 1];
+            ++scope.count;
+
+            const bool object =
+                impl::tapeTag(tape_.data()[scope.begin]) ==
+                impl::TapeTag::OBJECT;
+            const char chr = index_.peek(cursor);
+
+            if (chr == utils::COMMA) {
+                expect = object ? Expect::KEY : Expect::VALUE;
+            } else if (chr == (object ? utils::BRACE_CLOSE
+                                      : utils::BRACKET_CLOSE)) {
+                close();
+            } else {
+                return Err::JSON_SYNTAX_EXP_SEP;
+            }
+
+            ++cursor;
+            break;
+        }
+        }
+    }
+}
+
+inline Status Parser::open(impl::TapeTag tag) noexcept {
+    if (depth_ == impl::JSON_MAX_DEPTH) return Err::CAPACITY_EXCEEDED;
+
+    scopes_.data()[depth_++] = {
+        .begin = static_cast<u32>(words_),
+        .count = 0,
+    };
+    tape_.data()[words_++] = impl::tapeWord(tag, 0);
+
+    return {};
+}
+
+inline void Parser::close() noexcept {
+    const impl::TapeScope scope = scopes_.data()[--depth_];
+    const u64             count =
+        std::min<u64>(scope.count, impl::TAPE_COUNT_MAX);
+
+    tape_.data()[words_++] = impl::tapeWord(impl::TapeTag::END, scope.begin);
+
+    u64 &opener            = tape_.data()[scope.begin];
+    opener                 = impl::tapeWord(impl::tapeTag(opener),
+                                            (count << impl::TAPE_COUNT_SHIFT) |
+                                                words_);
+}
+
+inline Status Parser::scalar(usize cursor) noexcept {
+    switch (index_.peek(cursor)) {
+    case utils::DOUBLE_QUOTE: return string(cursor);
+    case utils::NUL         : [[fallthrough]];
+    case utils::COMMA       : [[fallthrough]];
+    case utils::COLON       : [[fallthrough]];
+    case utils::BRACE_CLOSE : [[fallthrough]];
+    case utils::BRACKET_CLOSE: return Err::JSON_SYNTAX_EXP_VALUE;
+    default                 : break;
+    }
+
+    const std::string_view token = index_.token(cursor);
+    u64                   *tape  = tape_.data();
+
+    if (token == "true") {
+        tape[words_++] = impl::tapeWord(impl::TapeTag::TRUE, 0);
+        return {};
+    }
+    if (token == "false") {
+        tape[words_++] = impl::tapeWord(impl::TapeTag::FALSE, 0);
+        return {};
+    }
+    if (token == "null") {
+        tape[words_++] = impl::tapeWord(impl::TapeTag::NUL, 0);
+        return {};
+    }
+
+    const Result<Number> number = impl::readNumber(token);
+    if (number.bad()) return number.err();
+
+    impl::TapeTag tag = impl::TapeTag::FLOAT;
+    switch (number.val().type) {
+    case NumberType::INT  : tag = impl::TapeTag::INT; break;
+    case NumberType::UINT : tag = impl::TapeTag::UINT; break;
+    case NumberType::FLOAT: tag = impl::TapeTag::FLOAT; break;
+    }
+
+    tape[words_++] = impl::tapeWord(tag, 0);
+    tape[words_++] = number.val().bits;
+
+    return {};
+}
+
+inline Status Parser::string(usize cursor) noexcept {
+    const std::string_view text  = index_.text();
+    const usize            first = index_.positions()[cursor] + 1;
+
+    char                  *dst = strings_.data() + used_;
+
+    const Result<impl::StringScan> scan = impl::unescapeString(
+        text.data() + first, text.data() + text.size(), dst + sizeof(u32));
+    if (scan.bad()) return scan.err();
+
+    const u32 length = static_cast<u32>(scan.val().length);
+    std::memcpy(dst, &length, sizeof(length));
+
+    tape_.data()[words_++] = impl::tapeWord(impl::TapeTag::STRING, used_);
+    used_                  += sizeof(length) + length;
+
+    return {};
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_PARSER_HPP
@@ -0,0 +1,317 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_POINTER_HPP
+#define SRR_JSON_POINTER_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/json/binary.hpp"
+#include "sierra/json/index.hpp"
+#include "sierra/json/lazy.hpp"
+#include "sierra/json/parser.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/char.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+
+inline namespace srr {
+namespace json {
+
+enum class PathSyntax : u8 {
+    // RFC 6901, "/a/b/3" with ~0 for '~' and ~1 for '/'. The empty pointer
+    // is the root.
+    POINTER = 0,
+
+    // "a.b[3].c", optionally starting with "$". Keys cannot contain '.'
+    // or '[', use POINTER for those.
+    DOTTED,
+};
+
+enum class StepKind : u8 {
+    // Pointer token, a member of an object or, when it is an index, an
+    // element of an array.
+    ANY = 0,
+    MEMBER,
+    ELEMENT,
+};
+
+struct PathStep {
+    StepKind         kind;
+    std::string_view key;
+
+    // impl::PATH_NO_INDEX unless the token is a canonical array index.
+    usize            index;
+};
+
+// Documents a Path resolves against.
+template<typename V>
+concept PathSource = std::same_as<V, Element> || std::same_as<V, LazyValue> ||
+                     std::same_as<V, BinaryValue>;
+
+namespace impl {
+
+constexpr usize PATH_NO_INDEX = USIZE_MAX;
+constexpr usize PATH_BASE     = 10;
+
+// Characters ending a dotted key.
+constexpr std::string_view PATH_KEY_END = ".[";
+
+// Canonical array index of token, digits without leading zeros, or
+// PATH_NO_INDEX.
+[[nodiscard]] constexpr usize pathIndex(std::string_view token) noexcept;
+
+} // namespace impl
+
+// Compiled JSON Pointer or dotted path. Compiling splits and unescapes the
+// text once, so resolving the same path against many documents does no
+// parsing of its own and each step is a single find() or at().
+//
+// Not thread-safe to compile, const access may be shared between threads.
+class Path {
+public:
+    [[nodiscard]] Path() noexcept;
+    [[nodiscard]] Path(Path &&path) noexcept;
+
+    Path(const Path &path)            = delete;
+    Path &operator=(const Path &path) = delete;
+    Path &operator=(Path &&path)      = delete;
+
+    ~Path() noexcept                  = default;
+
+    // Replaces the steps. Fails with JSON_BAD_TOKEN on malformed text, a
+    // pointer not starting with '/', a bad ~ escape, an empty dotted key or
+    // a bracket without a valid index, and with OUT_OF_MEMORY.
+    [[nodiscard]] Status compile(std::string_view text,
+                                 PathSyntax       syntax) noexcept;
+
+    [[nodiscard]] std::span<const PathStep> steps() const noexcept;
+
+private:
+    [[nodiscard]] Status pointer(std::string_view text) noexcept;
+    [[nodiscard]] Status dotted(std::string_view text) noexcept;
+
+    // Adds text_[begin, used_) as a new step.
+    void                 push(StepKind kind, usize begin) noexcept;
+
+    impl::JsonBuffer<PathStep> steps_;
+    impl::JsonBuffer<char>     text_;
+    usize                      count_;
+    usize                      used_;
+};
+
+// Walks path from root. Lazy and binary documents skip the subtrees before
+// each step without decoding them, tapes jump over them by their stored
+// extent. Fails with NO_SUCH_KEY or INDEX_OUT_OF_RANGE on a miss,
+// JSON_BAD_CAST when a step meets a value it cannot descend into, and with
+// the errors of the document.
+template<PathSource V>
+[[nodiscard]] Result<V> resolve(const Path &path, const V &root) noexcept;
+
+namespace impl {
+
+constexpr usize pathIndex(std::string_view token) noexcept {
+    if (token.empty()) return PATH_NO_INDEX;
+    if (token.size() > 1 && token.front() == utils::NUM_0)
+        return PATH_NO_INDEX;
+
+    usize index = 0;
+    for (const char chr : token) {
+        if (chr < utils::NUM_0 || chr > utils::NUM_9) return PATH_NO_INDEX;
+
+        const usize digit = static_cast<usize>(chr - utils::NUM_0);
+        if (index > (PATH_NO_INDEX - 1 - digit) / PATH_BASE)
+            return PATH_NO_INDEX;
+
+        index = (index * PATH_BASE) + digit;
+    }
+
+    return index;
+}
+
+} // namespace impl
+
+// Path ---
+
+inline Path::Path() noexcept : count_{ 0 }, used_{ 0 } {}
+
+inline Path::Path(Path &&path) noexcept :
+    steps_{ std::move(path.steps_) },
+    text_{ std::move(path.text_) },
+    count_{ std::exchange(path.count_, 0) },
+    used_{ std::exchange(path.used_, 0) } {}
+
+inline Status Path::compile(std::string_view text,
+                            PathSyntax       syntax) noexcept {
+    count_ = 0;
+    used_  = 0;
+
+    // Keys never outgrow the text, and a step takes at least one byte of
+    // it, so neither buffer moves while the views into text_ are taken.
+    const Status text_reserved = text_.reserve(text.size());
+    if (text_reserved.bad()) return text_reserved;
+
+    const Status steps_reserved = steps_.reserve(text.size());
+    if (steps_reserved.bad()) return steps_reserved;
+
+    const Status compiled =
+        syntax == PathSyntax::POINTER ? pointer(text) : dotted(text);
+    if (compiled.bad()) count_ = 0;
+
+    return compiled;
+}
+
+inline std::span<const PathStep> Path::steps() const noexcept {
+    return { steps_.data(), count_ };
+}
+
+inline Status Path::pointer(std::string_view text) noexcept {
+    if (text.empty()) return {};
+    if (text.front() != utils::SLASH) return Err::JSON_BAD_TOKEN;
+
+    usize pos = 1;
+    while (true) {
+        const usize begin = used_;
+
+        for (; pos < text.size() && text[pos] != utils::SLASH; ++pos) {
+            char chr = text[pos];
+            if (chr == utils::TILDE) {
+                if (++pos == text.size()) return Err::JSON_BAD_TOKEN;
+
+                switch (text[pos]) {
+                case utils::NUM_0: chr = utils::TILDE; break;
+                case utils::NUM_1: chr = utils::SLASH; break;
+                default          : return Err::JSON_BAD_TOKEN;
+                }
+            }
+
+            text_.data()[used_++] = chr;
+        }
+
+        push(StepKind::ANY, begin);
+        if (pos == text.size()) return {};
+
+        ++pos;
+    }
+}
+
+inline Status Path::dotted(std::string_view text) noexcept {
+    usize pos = text.starts_with(utils::DOLLAR) ? 1 : 0;
+
+    // The first key may go without its dot.
+    bool  bare = pos == 0 && !text.empty() &&
+                text.front() != utils::BRACKET_OPEN;
+
+    while (pos < text.size()) {
+        StepKind         kind = StepKind::MEMBER;
+        std::string_view key;
+
+        if (!bare && text[pos] == utils::BRACKET_OPEN) {
+            const usize close = text.find(utils::BRACKET_CLOSE, pos);
+            if (close == std::string_view::npos) return Err::JSON_BAD_TOKEN;
+
+            kind = StepKind::ELEMENT;
+            key  = text.substr(pos + 1, close - pos - 1);
+            if (impl::pathIndex(key) == impl::PATH_NO_INDEX)
+                return Err::JSON_BAD_TOKEN;
+
+            pos = close + 1;
+        } else {
+            if (!bare && text[pos++] != utils::DOT) return Err::JSON_BAD_TOKEN;
+
+            const usize end = std::min(
+                text.find_first_of(impl::PATH_KEY_END, pos), text.size());
+
+            key             = text.substr(pos, end - pos);
+            if (key.empty()) return Err::JSON_BAD_TOKEN;
+
+            pos = end;
+        }
+
+        bare               = false;
+
+        const usize begin  = used_;
+        std::memcpy(text_.data() + used_, key.data(), key.size());
+        used_             += key.size();
+
+        push(kind, begin);
+    }
+
+    return {};
+}
+
+inline void Path::push(StepKind kind, usize begin) noexcept {
+    const std::string_view key{ text_.data() + begin, used_ - begin };
+
+    steps_.data()[count_++] = {
+        .kind  = kind,
+        .key   = key,
+        .index = impl::pathIndex(key),
+    };
+}
+
+template<PathSource V>
+Result<V> resolve(const Path &path, const V &root) noexcept {
+    V value = root;
+
+    for (const PathStep &step : path.steps()) {
+        const Type type = value.type();
+
+        if (type == Type::OBJECT && step.kind != StepKind::ELEMENT) {
+            const Result<V> member = find(value, step.key);
+            if (member.bad()) return member.err();
+
+            value = member.val();
+        } else if (type == Type::ARRAY && step.kind != StepKind::MEMBER) {
+            if (step.index == impl::PATH_NO_INDEX)
+                return Err::INDEX_OUT_OF_RANGE;
+
+            const Result<V> element = at(value, step.index);
+            if (element.bad()) return element.err();
+
+            value = element.val();
+        } else {
+            return Err::JSON_BAD_CAST;
+        }
+    }
+
+    return value;
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_POINTER_HPP
@@ -0,0 +1,748 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_SCALAR_HPP
+#define SRR_JSON_SCALAR_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/utils/char.hpp"
+#include "sierra/utils/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+inline namespace srr {
+namespace json {
+
+enum class Type : u8 {
+    NUL = 0,
+    BOOL,
+    NUMBER,
+    STRING,
+    ARRAY,
+    OBJECT,
+};
+
+// INT for integers that fit an i64, UINT for larger non-negative integers,
+// FLOAT for everything with a fraction, an exponent or out of integer range.
+enum class NumberType : u8 {
+    INT = 0,
+    UINT,
+    FLOAT,
+};
+
+// Decoded number, bits holds the i64, u64 or f64 pattern named by type.
+struct Number {
+    NumberType type;
+    u64        bits;
+};
+
+template<typename T>
+concept NumberValue = std::same_as<T, i64> || std::same_as<T, u64> ||
+                      std::same_as<T, f64>;
+
+template<NumberValue T>
+[[nodiscard]] constexpr Number makeNumber(T value) noexcept;
+
+namespace impl {
+
+constexpr u32   JSON_HEX_DIGITS   = 4;
+constexpr u32   JSON_HEX_INVALID  = U32_MAX;
+
+constexpr u32   UTF8_MAX_1        = 0x7F;
+constexpr u32   UTF8_MAX_2        = 0x7FF;
+constexpr u32   UTF8_MAX_3        = 0xFFFF;
+constexpr u32   UTF8_CONT_BITS    = 6;
+constexpr u32   UTF8_CONT_MASK    = 0x3F;
+constexpr u32   UTF8_CONT_TAG     = 0x80;
+constexpr u32   UTF8_LEAD_2       = 0xC0;
+constexpr u32   UTF8_LEAD_3       = 0xE0;
+constexpr u32   UTF8_LEAD_4       = 0xF0;
+
+constexpr u32   SURROGATE_HIGH    = 0xD800;
+constexpr u32   SURROGATE_LOW     = 0xDC00;
+constexpr u32   SURROGATE_END     = 0xE000;
+constexpr u32   SURROGATE_BITS    = 10;
+constexpr u32   SURROGATE_BASE    = 0x1'0000;
+
+constexpr usize JSON_ESCAPE_SHORT = 2;
+constexpr usize JSON_ESCAPE_UNIT  = 2 + JSON_HEX_DIGITS;
+
+// Bytes written past the end of an unescaped string, output buffers must
+// keep this much slack.
+constexpr usize JSON_STRING_SLACK = utils::SIMD_WIDTH;
+
+// Deepest nesting the parsers accept.
+constexpr usize JSON_MAX_DEPTH    = 1024;
+
+struct StringScan {
+    usize length;
+    usize consumed;
+};
+
+// Floating point from_chars is missing from libc++ before LLVM 20, which
+// leaves __cpp_lib_to_chars undefined. Floats are decoded by hand there,
+// independent of the locale and without any global state.
+#ifndef __cpp_lib_to_chars
+
+// Significant digits kept, enough to round every f64 correctly. Digits past
+// it only mark the decimal as truncated for breaking ties.
+constexpr usize FLOAT_DIGITS     = 800;
+
+// Larger exponents overflow or underflow anyway.
+constexpr i64   FLOAT_EXP_CAP    = 10'000;
+
+// Beyond these decimal points the value is infinite or zero.
+constexpr i64   FLOAT_POINT_MAX  = 310;
+constexpr i64   FLOAT_POINT_MIN  = -330;
+
+// Widest binary shift of the decimal at once, keeps the carries in a u64.
+constexpr u32   FLOAT_SHIFT_MAX  = 60;
+
+// f64 layout.
+constexpr u32   FLOAT_MANT_BITS  = 52;
+constexpr i64   FLOAT_BIAS       = -1023;
+constexpr i64   FLOAT_EXP_LIMIT  = 0x7FF;
+constexpr u32   FLOAT_SIGN_SHIFT = 63;
+
+// Mantissas and powers of ten exact in an f64, their product or quotient is
+// rounded once and so correctly.
+constexpr usize FLOAT_EXACT_DIGITS = 19;
+constexpr u64   FLOAT_EXACT_MANT   = u64{ 1 } << (FLOAT_MANT_BITS + 1);
+constexpr i64   FLOAT_EXACT_POW    = 22;
+
+constexpr std::array<f64, FLOAT_EXACT_POW + 1> FLOAT_POW10{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// Binary shift per step that moves the decimal point by the index, the
+// widest that does not cross zero.
+constexpr std::array<u32, 9> FLOAT_POW_SHIFT{ 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+constexpr u32                FLOAT_POW_SHIFT_MAX = 27;
+
+// Value 0.digits * 10^point with the digits as numbers, not characters.
+struct FloatDecimal {
+    std::array<u8, FLOAT_DIGITS> digits;
+    usize                        count;
+    i64                          point;
+    bool                         truncated;
+};
+
+#endif // __cpp_lib_to_chars
+
+[[nodiscard]] constexpr bool isSpace(char chr) noexcept;
+[[nodiscard]] constexpr bool isOperator(char chr) noexcept;
+
+// Validates the JSON number grammar and decodes the token.
+[[nodiscard]] inline Result<Number> readNumber(std::string_view token) noexcept;
+
+// Decodes a token readNumber() validated as a float.
+[[nodiscard]] inline Result<f64>    readFloat(std::string_view token) noexcept;
+
+#ifndef __cpp_lib_to_chars
+
+// Reads the digits and exponent of token, returns whether it is negative.
+[[nodiscard]] inline bool floatParse(std::string_view token,
+                                     FloatDecimal    &dec) noexcept;
+
+// Multiplies the decimal by 2^shift, divides for a negative shift.
+inline void               floatShift(FloatDecimal &dec, i64 shift) noexcept;
+inline void               floatShiftLeft(FloatDecimal &dec, u32 shift) noexcept;
+inline void floatShiftRight(FloatDecimal &dec, u32 shift) noexcept;
+
+// Stores digit at pos, or marks it truncated when pos is past the buffer.
+inline void floatPut(FloatDecimal &dec, usize pos, u64 digit) noexcept;
+inline void floatTrim(FloatDecimal &dec) noexcept;
+
+// Integer part rounded half to even.
+[[nodiscard]] inline u64 floatRounded(const FloatDecimal &dec) noexcept;
+
+#endif // __cpp_lib_to_chars
+
+template<NumberValue T>
+[[nodiscard]] Result<T> numberAs(Number number) noexcept;
+
+// Unescapes the string body that follows an opening quote up to the closing
+// quote, consumed includes the closing quote. dst needs the length of the
+// body plus JSON_STRING_SLACK bytes.
+[[nodiscard]] inline Result<StringScan> unescapeString(const char *src,
+                                                       const char *end,
+                                                       char *dst) noexcept;
+
+[[nodiscard]] constexpr u32   hexValue(char chr) noexcept;
+[[nodiscard]] inline u32      readHex(const char *src) noexcept;
+[[nodiscard]] constexpr usize encodeUtf8(u32 code, char *dst) noexcept;
+
+constexpr bool                isSpace(char chr) noexcept {
+    switch (chr) {
+    case utils::SPACE: [[fallthrough]];
+    case utils::HT   : [[fallthrough]];
+    case utils::LF   : [[fallthrough]];
+    case utils::CR   : return true;
+    default          : return false;
+    }
+}
+
+constexpr bool isOperator(char chr) noexcept {
+    switch (chr) {
+    case utils::BRACE_OPEN   : [[fallthrough]];
+    case utils::BRACE_CLOSE  : [[fallthrough]];
+    case utils::BRACKET_OPEN : [[fallthrough]];
+    case utils::BRACKET_CLOSE: [[fallthrough]];
+    case utils::COLON        : [[fallthrough]];
+    case utils::COMMA        : return true;
+    default                  : return false;
+    }
+}
+
+inline Result<Number> readNumber(std::string_view token) noexcept {
+    const char *ptr = token.data();
+    const usize len = token.size();
+    usize       pos = 0;
+
+    if (pos < len && ptr[pos] == utils::MINUS) ++pos;
+    if (pos == len || !utils::isDigit(ptr[pos])) return Err::JSON_BAD_TOKEN;
+
+    // No leading zeros.
+    if (ptr[pos] == utils::NUM_0) {
+        ++pos;
+    } else {
+        while (pos < len && utils::isDigit(ptr[pos])) ++pos;
+    }
+
+    bool integral = true;
+
+    if (pos < len && ptr[pos] == utils::DOT) {
+        integral = false;
+        ++pos;
+
+        if (pos == len || !utils::isDigit(ptr[pos]))
+            return Err::JSON_BAD_TOKEN;
+        while (pos < len && utils::isDigit(ptr[pos])) ++pos;
+    }
+
+    if (pos < len && (ptr[pos] == utils::E || ptr[pos] == utils::UP_E)) {
+        integral = false;
+        ++pos;
+
+        if (pos < len && (ptr[pos] == utils::PLUS || ptr[pos] == utils::MINUS))
+            ++pos;
+        if (pos == len || !utils::isDigit(ptr[pos]))
+            return Err::JSON_BAD_TOKEN;
+        while (pos < len && utils::isDigit(ptr[pos])) ++pos;
+    }
+
+    if (pos != len) return Err::JSON_BAD_TOKEN;
+
+    const char *end = ptr + len;
+
+    if (integral) {
+        i64 value = 0;
+        if (std::from_chars(ptr, end, value).ec == std::errc{})
+            return Number{
+                .type = NumberType::INT,
+                .bits = std::bit_cast<u64>(value),
+            };
+
+        u64 large = 0;
+        if (ptr[0] != utils::MINUS &&
+            std::from_chars(ptr, end, large).ec == std::errc{})
+            return Number{ .type = NumberType::UINT, .bits = large };
+    }
+
+    const Result<f64> value = readFloat(token);
+    if (value.bad()) return value.err();
+
+    return Number{
+        .type = NumberType::FLOAT,
+        .bits = std::bit_cast<u64>(value.val()),
+    };
+}
+
+#ifdef __cpp_lib_to_chars
+
+inline Result<f64> readFloat(std::string_view token) noexcept {
+    f64 value = 0;
+    if (std::from_chars(token.data(), token.data() + token.size(), value).ec !=
+        std::errc{})
+        return Err::JSON_BAD_TOKEN;
+
+    return value;
+}
+
+#else
+
+inline Result<f64> readFloat(std::string_view token) noexcept {
+    FloatDecimal dec{};
+    const bool   negative = floatParse(token, dec);
+    const u64    sign     = u64{ negative } << FLOAT_SIGN_SHIFT;
+
+    if (dec.count == 0) return std::bit_cast<f64>(sign);
+
+    if (!dec.truncated && dec.count <= FLOAT_EXACT_DIGITS) {
+        u64 mant = 0;
+        for (usize i = 0; i < dec.count; ++i)
+            mant = (mant * BASE_DECIMAL) + dec.digits[i];
+
+        const i64 exp = dec.point - static_cast<i64>(dec.count);
+        if (mant <= FLOAT_EXACT_MANT && exp >= -FLOAT_EXACT_POW &&
+            exp <= FLOAT_EXACT_POW) {
+            const f64 value =
+                exp < 0 ? static_cast<f64>(mant) /
+                              FLOAT_POW10[static_cast<usize>(-exp)]
+                        : static_cast<f64>(mant) *
+                              FLOAT_POW10[static_cast<usize>(exp)];
+
+            return negative ? -value : value;
+        }
+    }
+
+    // Out of range fails like from_chars, overflow and underflow to zero
+    // alike. Subnormals are fine.
+    if (dec.point > FLOAT_POINT_MAX || dec.point < FLOAT_POINT_MIN)
+        return Err::JSON_BAD_TOKEN;
+
+    // Scale into [0.5, 1) by powers of two, counting them in exp.
+    i64 exp = 0;
+    while (dec.point > 0) {
+        const u32 shift =
+            dec.point < static_cast<i64>(FLOAT_POW_SHIFT.size())
+                ? FLOAT_POW_SHIFT[static_cast<usize>(dec.point)]
+                : FLOAT_POW_SHIFT_MAX;
+
+        floatShift(dec, -static_cast<i64>(shift));
+        exp += shift;
+    }
+
+    while (dec.point < 0 || (dec.point == 0 && dec.digits[0] < 5)) {
+        const u32 shift =
+            -dec.point < static_cast<i64>(FLOAT_POW_SHIFT.size())
+                ? FLOAT_POW_SHIFT[static_cast<usize>(-dec.point)]
+                : FLOAT_POW_SHIFT_MAX;
+
+        floatShift(dec, shift);
+        exp -= shift;
+    }
+
+    // From [0.5, 1) to the [1, 2) of the f64 mantissa, subnormals sit at
+    // the smallest exponent with a smaller mantissa.
+    --exp;
+    if (exp < FLOAT_BIAS + 1) {
+        floatShift(dec, exp - (FLOAT_BIAS + 1));
+        exp = FLOAT_BIAS + 1;
+    }
+
+    if (exp - FLOAT_BIAS >= FLOAT_EXP_LIMIT) return Err::JSON_BAD_TOKEN;
+
+    floatShift(dec, FLOAT_MANT_BITS + 1);
+    u64 mant = floatRounded(dec);
+
+    // Rounding up may carry into a new bit.
+    if (mant == u64{ 2 } << FLOAT_MANT_BITS) {
+        mant >>= 1;
+        if (++exp - FLOAT_BIAS >= FLOAT_EXP_LIMIT) return Err::JSON_BAD_TOKEN;
+    }
+
+    if (mant == 0) return Err::JSON_BAD_TOKEN;
+    if ((mant & (u64{ 1 } << FLOAT_MANT_BITS)) == 0) exp = FLOAT_BIAS;
+
+    const u64 bits = (mant & ((u64{ 1 } << FLOAT_MANT_BITS) - 1)) |
+                     (static_cast<u64>(exp - FLOAT_BIAS) << FLOAT_MANT_BITS) |
+                     sign;
+
+    return std::bit_cast<f64>(bits);
+}
+
+inline bool floatParse(std::string_view token, FloatDecimal &dec) noexcept {
+    usize      pos      = 0;
+    const bool negative = token[pos] == utils::MINUS;
+    if (negative) ++pos;
+
+    // Leading zeros only move the point, it is taken as written when the
+    // token has a dot and after the last digit otherwise.
+    bool dot = false;
+    for (; pos < token.size(); ++pos) {
+        const char chr = token[pos];
+        if (chr == utils::DOT) {
+            dot       = true;
+            dec.point = static_cast<i64>(dec.count);
+            continue;
+        }
+
+        if (!utils::isDigit(chr)) break;
+
+        const u8 digit = static_cast<u8>(chr - utils::NUM_0);
+        if (digit == 0 && dec.count == 0) {
+            --dec.point;
+        } else if (dec.count < FLOAT_DIGITS) {
+            dec.digits[dec.count++] = digit;
+        } else if (digit != 0) {
+            dec.truncated = true;
+        }
+    }
+
+    if (!dot) dec.point = static_cast<i64>(dec.count);
+
+    if (pos < token.size()) {
+        // Past the e or E.
+        ++pos;
+
+        const bool down = token[pos] == utils::MINUS;
+        if (down || token[pos] == utils::PLUS) ++pos;
+
+        i64 exp = 0;
+        for (; pos < token.size(); ++pos)
+            if (exp < FLOAT_EXP_CAP)
+                exp = (exp * BASE_DECIMAL) + (token[pos] - utils::NUM_0);
+
+        dec.point += down ? -exp : exp;
+    }
+
+    floatTrim(dec);
+
+    return negative;
+}
+
+inline void floatShift(FloatDecimal &dec, i64 shift) noexcept {
+    if (dec.count == 0) return;
+
+    const i64 step = FLOAT_SHIFT_MAX;
+    for (; shift > step; shift -= step) floatShiftLeft(dec, FLOAT_SHIFT_MAX);
+    for (; shift < -step; shift += step) floatShiftRight(dec, FLOAT_SHIFT_MAX);
+
+    if (shift > 0) floatShiftLeft(dec, static_cast<u32>(shift));
+    if (shift < 0) floatShiftRight(dec, static_cast<u32>(-shift));
+}
+
+inline void floatShiftLeft(FloatDecimal &dec, u32 shift) noexcept {
+    // Doubling adds log10(2) digits, 78913 / 2^18 bounds that from above.
+    const usize grow = ((static_cast<usize>(shift) * 78'913) >> 18) + 1;
+    const usize span = dec.count + grow;
+
+    // Multiplied from the last digit, writing grow places further right so
+    // no digit is overwritten before it is read. Digits that land past the
+    // buffer only count towards truncation.
+    usize write = span;
+    u64   carry = 0;
+
+    for (usize read = dec.count; read-- > 0; carry /= BASE_DECIMAL) {
+        carry += u64{ dec.digits[read] } << shift;
+        floatPut(dec, --write, carry % BASE_DECIMAL);
+    }
+
+    for (; carry > 0; carry /= BASE_DECIMAL)
+        floatPut(dec, --write, carry % BASE_DECIMAL);
+
+    // grow overestimates by at most one digit, drop the unused places.
+    const usize end = std::min(span, FLOAT_DIGITS);
+    std::memmove(dec.digits.data(), dec.digits.data() + write, end - write);
+
+    dec.count  = end - write;
+    dec.point += static_cast<i64>(grow - write);
+    floatTrim(dec);
+}
+
+inline void floatShiftRight(FloatDecimal &dec, u32 shift) noexcept {
+    usize read  = 0;
+    usize write = 0;
+    u64   value = 0;
+
+    // Take enough leading digits for the first output digit.
+    for (; (value >> shift) == 0; ++read) {
+        if (read >= dec.count) {
+            if (value == 0) {
+                dec.count = 0;
+                return;
+            }
+
+            for (; (value >> shift) == 0; ++read) value *= BASE_DECIMAL;
+            break;
+        }
+
+        value = (value * BASE_DECIMAL) + dec.digits[read];
+    }
+
+    dec.point      -= static_cast<i64>(read) - 1;
+
+    const u64 mask  = (u64{ 1 } << shift) - 1;
+    for (; read < dec.count; ++read) {
+        const u64 digit      = value >> shift;
+        value               &= mask;
+        dec.digits[write++]  = static_cast<u8>(digit);
+        value                = (value * BASE_DECIMAL) + dec.digits[read];
+    }
+
+    for (; value > 0; value = (value & mask) * BASE_DECIMAL) {
+        floatPut(dec, write, value >> shift);
+        if (write < FLOAT_DIGITS) ++write;
+    }
+
+    dec.count = write;
+    floatTrim(dec);
+}
+
+inline void floatPut(FloatDecimal &dec, usize pos, u64 digit) noexcept {
+    if (pos < FLOAT_DIGITS)
+        dec.digits[pos] = static_cast<u8>(digit);
+    else if (digit != 0)
+        dec.truncated = true;
+}
+
+inline void floatTrim(FloatDecimal &dec) noexcept {
+    while (dec.count > 0 && dec.digits[dec.count - 1] == 0) --dec.count;
+    if (dec.count == 0) dec.point = 0;
+}
+
+inline u64 floatRounded(const FloatDecimal &dec) noexcept {
+    // Below one half, as deep subnormals end up.
+    if (dec.point < 0) return 0;
+
+    const usize point = static_cast<usize>(dec.point);
+
+    u64         value = 0;
+    for (usize i = 0; i < point; ++i)
+        value = (value * BASE_DECIMAL) + (i < dec.count ? dec.digits[i] : 0);
+
+    if (point >= dec.count) return value;
+
+    // Exactly half rounds to even, unless truncated digits tip it over.
+    const bool half = dec.digits[point] == 5 && point + 1 == dec.count;
+    if (half) {
+        if (dec.truncated || (point > 0 && dec.digits[point - 1] % 2 == 1))
+            ++value;
+    } else if (dec.digits[point] >= 5) {
+        ++value;
+    }
+
+    return value;
+}
+
+#endif // __cpp_lib_to_chars
+
+template<NumberValue T>
+Result<T> numberAs(Number number) noexcept {
+    if constexpr (std::same_as<T, f64>) {
+        switch (number.type) {
+        case NumberType::INT:
+            return static_cast<f64>(std::bit_cast<i64>(number.bits));
+        case NumberType::UINT : return static_cast<f64>(number.bits);
+        case NumberType::FLOAT: return std::bit_cast<f64>(number.bits);
+        }
+    } else if constexpr (std::same_as<T, i64>) {
+        if (number.type != NumberType::INT) return Err::JSON_BAD_SUBTYPE;
+
+        return std::bit_cast<i64>(number.bits);
+    } else {
+        if (number.type == NumberType::UINT) return number.bits;
+
+        if (number.type != NumberType::INT ||
+            std::bit_cast<i64>(number.bits) < 0)
+            return Err::JSON_BAD_SUBTYPE;
+
+        return number.bits;
+    }
+
+    return Err::JSON_BAD_SUBTYPE;
+}
+
+inline Result<StringScan> unescapeString(const char *src,
+                                         const char *end,
+                                         char       *dst) noexcept {
+    const char *const begin = src;
+    char *const       out   = dst;
+
+    const utils::U8x16 quote =
+        utils::U8x16::splat(static_cast<u8>(utils::DOUBLE_QUOTE));
+    const utils::U8x16 slash =
+        utils::U8x16::splat(static_cast<u8>(utils::BACKSLASH));
+
+    while (true) {
+        // Copy whole blocks until one holds a quote or a backslash.
+        while (static_cast<usize>(end - src) >= utils::SIMD_WIDTH) {
+            const utils::U8x16 block = utils::U8x16::load(src);
+            block.store(dst);
+
+            const u32 special = block.eq(quote).bitOr(block.eq(slash)).mask();
+            if (special == 0) {
+                src += utils::SIMD_WIDTH;
+                dst += utils::SIMD_WIDTH;
+                continue;
+            }
+
+            const usize skip = static_cast<usize>(std::countr_zero(special));
+            src += skip;
+            dst += skip;
+            break;
+        }
+
+        while (src < end && *src != utils::DOUBLE_QUOTE &&
+               *src != utils::BACKSLASH)
+            *dst++ = *src++;
+
+        if (src == end) return Err::JSON_BAD_TOKEN;
+
+        if (*src == utils::DOUBLE_QUOTE) {
+            return StringScan{
+                .length   = static_cast<usize>(dst - out),
+                .consumed = static_cast<usize>(src - begin) + 1,
+            };
+        }
+
+        if (static_cast<usize>(end - src) < JSON_ESCAPE_SHORT)
+            return Err::JSON_BAD_TOKEN;
+
+        switch (src[1]) {
+        case utils::DOUBLE_QUOTE: *dst++ = utils::DOUBLE_QUOTE; break;
+        case utils::BACKSLASH   : *dst++ = utils::BACKSLASH; break;
+        case utils::SLASH       : *dst++ = utils::SLASH; break;
+        case utils::B           : *dst++ = utils::BS; break;
+        case utils::F           : *dst++ = utils::FF; break;
+        case utils::N           : *dst++ = utils::LF; break;
+        case utils::R           : *dst++ = utils::CR; break;
+        case utils::T           : *dst++ = utils::HT; break;
+        case utils::U           : break;
+        default                 : return Err::JSON_BAD_TOKEN;
+        }
+
+        if (src[1] != utils::U) {
+            src += JSON_ESCAPE_SHORT;
+            continue;
+        }
+
+        if (static_cast<usize>(end - src) < JSON_ESCAPE_UNIT)
+            return Err::JSON_BAD_TOKEN;
+
+        u32 code = readHex(src + JSON_ESCAPE_SHORT);
+        src      += JSON_ESCAPE_UNIT;
+
+        if (code == JSON_HEX_INVALID) return Err::JSON_BAD_TOKEN;
+
+        // Surrogates must come as a high and low pair.
+        if (code >= SURROGATE_HIGH && code < SURROGATE_END) {
+            if (code >= SURROGATE_LOW ||
+                static_cast<usize>(end - src) < JSON_ESCAPE_UNIT ||
+                src[0] != utils::BACKSLASH || src[1] != utils::U)
+                return Err::JSON_BAD_TOKEN;
+
+            const u32 low = readHex(src + JSON_ESCAPE_SHORT);
+            if (low < SURROGATE_LOW || low >= SURROGATE_END)
+                return Err::JSON_BAD_TOKEN;
+
+            src  += JSON_ESCAPE_UNIT;
+            code  = SURROGATE_BASE +
+                   ((code - SURROGATE_HIGH) << SURROGATE_BITS) +
+                   (low - SURROGATE_LOW);
+        }
+
+        dst += encodeUtf8(code, dst);
+    }
+}
+
+constexpr u32 hexValue(char chr) noexcept {
+    if (chr >= utils::NUM_0 && chr <= utils::NUM_9)
+        return static_cast<u32>(chr - utils::NUM_0);
+    if (chr >= utils::A && chr <= utils::F)
+        return static_cast<u32>(chr - utils::A) + BASE_DECIMAL;
+    if (chr >= utils::UP_A && chr <= utils::UP_F)
+        return static_cast<u32>(chr - utils::UP_A) + BASE_DECIMAL;
+
+    return JSON_HEX_INVALID;
+}
+
+inline u32 readHex(const char *src) noexcept {
+    constexpr u32 NIBBLE = 4;
+
+    u32           code   = 0;
+    for (u32 i = 0; i < JSON_HEX_DIGITS; ++i) {
+        const u32 digit = hexValue(src[i]);
+        if (digit == JSON_HEX_INVALID) return JSON_HEX_INVALID;
+
+        code = (code << NIBBLE) | digit;
+    }
+
+    return code;
+}
+
+constexpr usize encodeUtf8(u32 code, char *dst) noexcept {
+    if (code <= UTF8_MAX_1) {
+        dst[0] = static_cast<char>(code);
+        return 1;
+    }
+
+    if (code <= UTF8_MAX_2) {
+        dst[0] = static_cast<char>(UTF8_LEAD_2 | (code >> UTF8_CONT_BITS));
+        dst[1] = static_cast<char>(UTF8_CONT_TAG | (code & UTF8_CONT_MASK));
+        return 2;
+    }
+
+    if (code <= UTF8_MAX_3) {
+        dst[0] =
+            static_cast<char>(UTF8_LEAD_3 | (code >> (UTF8_CONT_BITS * 2)));
+        dst[1] = static_cast<char>(UTF8_CONT_TAG |
+                                   ((code >> UTF8_CONT_BITS) & UTF8_CONT_MASK));
+        dst[2] = static_cast<char>(UTF8_CONT_TAG | (code & UTF8_CONT_MASK));
+        return 3;
+    }
+
+    dst[0] = static_cast<char>(UTF8_LEAD_4 | (code >> (UTF8_CONT_BITS * 3)));
+    dst[1] = static_cast<char>(
+        UTF8_CONT_TAG | ((code >> (UTF8_CONT_BITS * 2)) & UTF8_CONT_MASK));
+    dst[2] = static_cast<char>(UTF8_CONT_TAG |
+                               ((code >> UTF8_CONT_BITS) & UTF8_CONT_MASK));
+    dst[3] = static_cast<char>(UTF8_CONT_TAG | (code & UTF8_CONT_MASK));
+    return 4;
+}
+
+} // namespace impl
+
+template<NumberValue T>
+constexpr Number makeNumber(T value) noexcept {
+    if constexpr (std::same_as<T, i64>) {
+        return { .type = NumberType::INT, .bits = std::bit_cast<u64>(value) };
+    } else if constexpr (std::same_as<T, u64>) {
+        return { .type = NumberType::UINT, .bits = value };
+    } else {
+        return { .type = NumberType::FLOAT, .bits = std::bit_cast<u64>(value) };
+    }
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_SCALAR_HPP
@@ -0,0 +1,744 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_STREAM_HPP
+#define SRR_JSON_STREAM_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/fsys/file.hpp"
+#include "sierra/json/index.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/char.hpp"
+#include "sierra/utils/simd.hpp"
+#include "sierra/utils/utf8.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+inline namespace srr {
+namespace json {
+
+// Fills buffer with the next bytes of the stream, returns how many. Zero
+// means the stream has ended, an error fails the reader with it.
+using StreamRead = Result<usize> (*)(std::span<char> buffer,
+                                     void           *user) noexcept;
+
+struct StreamSource {
+    StreamRead read;
+    void      *user;
+};
+
+enum class StreamMode : u8 {
+    // A single root value.
+    DOCUMENT = 0,
+
+    // Root values on their own lines, each followed by RECORD_END. A record
+    // may not span lines.
+    NDJSON,
+};
+
+struct StreamConfig {
+    // Read buffer size, also the longest token the reader accepts.
+    usize      buffer;
+    StreamMode mode;
+};
+
+enum class TokenType : u8 {
+    OBJECT_BEGIN = 0,
+    OBJECT_END,
+    ARRAY_BEGIN,
+    ARRAY_END,
+    KEY,
+    STRING,
+    NUMBER,
+    BOOL,
+    NUL,
+    RECORD_END,
+    END,
+};
+
+// Text views are valid until the next call to the reader that produced it.
+struct Token {
+    TokenType        type;
+
+    // Of the token's first byte in the stream.
+    u64              offset;
+
+    // Unescaped for KEY and STRING, as written for NUMBER.
+    std::string_view text;
+    Number           number;
+    bool             boolean;
+};
+
+// Whole records produced by RecordSplitter, valid until its next call.
+struct RecordBatch {
+    std::string_view text;
+    u64              offset;
+};
+
+[[nodiscard]] StreamConfig        makeStreamConfig() noexcept;
+
+// Reads through a FileRead, which must outlive the source.
+[[nodiscard]] inline StreamSource makeFileSource(fsys::FileRead &file) noexcept;
+
+// Slice part of parts of text, cut after newlines so that every line lands
+// in exactly one slice. Workers can take their share of a RecordBatch by
+// index without coordinating.
+[[nodiscard]] inline std::string_view splitBatch(std::string_view text,
+                                                 usize            part,
+                                                 usize parts) noexcept;
+
+// Pops the next non-empty line off text, without the newline.
+[[nodiscard]] inline std::string_view takeRecord(
+    std::string_view &text) noexcept;
+
+namespace impl {
+
+constexpr usize STREAM_DEFAULT_BUFFER = 64ULL * 1024ULL;
+constexpr usize STREAM_STACK_WORDS    = JSON_MAX_DEPTH / JSON_BLOCK;
+
+[[nodiscard]] inline Result<usize> readFile(std::span<char> buffer,
+                                            void           *user) noexcept;
+
+// The closing quote of the string body at src, nullptr when the body runs
+// past end. Fails with JSON_BAD_TOKEN on raw control characters.
+[[nodiscard]] inline Result<const char *> findQuote(const char *src,
+                                                    const char *end) noexcept;
+
+// Cut point at or after pos, just past the next newline.
+[[nodiscard]] inline usize lineBoundary(std::string_view text,
+                                        usize            pos) noexcept;
+
+} // namespace impl
+
+// Pull tokenizer over a StreamSource in constant memory, a fixed read buffer
+// and a bit per nesting level. Tokens split across reads are completed by
+// moving the unread tail to the front and reading more, so no token may be
+// longer than the buffer.
+//
+// Errors are the JSON_SYNTAX_* codes, JSON_BAD_TOKEN, INVALID_UTF8 in
+// strings, CAPACITY_EXCEEDED for overlong tokens or nesting past
+// JSON_MAX_DEPTH, and whatever the source fails with. errorOffset() gives
+// the byte offset of the failure, and the reader keeps failing once it has
+// failed. Not thread-safe.
+class StreamReader {
+public:
+    [[nodiscard]] StreamReader(StreamSource source,
+                               StreamConfig config) noexcept;
+
+    StreamReader(const StreamReader &reader)            = delete;
+    StreamReader(StreamReader &&reader)                 = delete;
+    StreamReader &operator=(const StreamReader &reader) = delete;
+    StreamReader &operator=(StreamReader &&reader)      = delete;
+
+    ~StreamReader() noexcept                            = default;
+
+    // The first error, OUT_OF_MEMORY when the buffers could not be
+    // allocated.
+    [[nodiscard]] Status        status() const noexcept;
+
+    // END once the input is exhausted, and from then on.
+    [[nodiscard]] Result<Token> next() noexcept;
+
+    [[nodiscard]] u64           offset() const noexcept;
+    [[nodiscard]] u64           errorOffset() const noexcept;
+
+private:
+    enum class Expect : u8 {
+        VALUE = 0,
+        FIRST_VALUE,
+        KEY,
+        FIRST_KEY,
+        COLON,
+        NEXT,
+        RECORD,
+        ROOT,
+        DONE,
+    };
+
+    [[nodiscard]] Result<Token> value() noexcept;
+    [[nodiscard]] Result<Token> key() noexcept;
+    [[nodiscard]] Result<Token> separator() noexcept;
+    [[nodiscard]] Result<Token> string(TokenType type) noexcept;
+    [[nodiscard]] Result<Token> scalar() noexcept;
+
+    [[nodiscard]] Result<Token> open(TokenType type) noexcept;
+    [[nodiscard]] Result<Token> close(TokenType type) noexcept;
+    [[nodiscard]] Token         make(TokenType type, usize begin) noexcept;
+    [[nodiscard]] Err           fail(Err err, usize pos) noexcept;
+
+    // Skips whitespace, false at the end of the input or, in NDJSON mode,
+    // at a newline inside a record.
+    [[nodiscard]] bool          skipSpace() noexcept;
+
+    // Moves the unread bytes to the front and reads more, false when
+    // nothing more came. Read errors fail the reader.
+    bool                        fill() noexcept;
+
+    [[nodiscard]] bool          object() const noexcept;
+
+    StreamSource                              source_;
+    StreamMode                                mode_;
+    Status                                    status_;
+    impl::JsonBuffer<char>                    buffer_;
+    impl::JsonBuffer<char>                    text_;
+    std::array<u64, impl::STREAM_STACK_WORDS> stack_;
+    usize                                     capacity_;
+    usize                                     pos_;
+    usize                                     end_;
+    u64                                       base_;
+    u64                                       error_offset_;
+    usize                                     depth_;
+    Expect                                    expect_;
+    bool                                      eof_;
+    bool                                      newline_;
+};
+
+// Cuts an NDJSON stream into batches of whole records without parsing them,
+// each batch filling as much of the fixed buffer as whole lines allow.
+// Batches can be handed to workers with splitBatch() and parsed there.
+// Not thread-safe, a batch is valid until the next call.
+class RecordSplitter {
+public:
+    [[nodiscard]] RecordSplitter(StreamSource source, usize capacity) noexcept;
+
+    RecordSplitter(const RecordSplitter &splitter)            = delete;
+    RecordSplitter(RecordSplitter &&splitter)                 = delete;
+    RecordSplitter &operator=(const RecordSplitter &splitter) = delete;
+    RecordSplitter &operator=(RecordSplitter &&splitter)      = delete;
+
+    ~RecordSplitter() noexcept                                = default;
+
+    // OUT_OF_MEMORY when the buffer could not be allocated.
+    [[nodiscard]] Status              status() const noexcept;
+
+    // An empty batch at the end of the stream. Fails with CAPACITY_EXCEEDED
+    // for a record longer than the buffer, or with the source's error.
+    [[nodiscard]] Result<RecordBatch> next() noexcept;
+
+private:
+    StreamSource           source_;
+    Status                 status_;
+    impl::JsonBuffer<char> buffer_;
+    usize                  capacity_;
+    usize                  pos_;
+    usize                  end_;
+    u64                    base_;
+    bool                   eof_;
+};
+
+inline StreamConfig makeStreamConfig() noexcept {
+    return {
+        .buffer = impl::STREAM_DEFAULT_BUFFER,
+        .mode   = StreamMode::DOCUMENT,
+    };
+}
+
+inline StreamSource makeFileSource(fsys::FileRead &file) noexcept {
+    return { .read = impl::readFile, .user = &file };
+}
+
+inline std::string_view splitBatch(std::string_view text,
+                                   usize            part,
+                                   usize            parts) noexcept {
+    if (parts == 0 || part >= parts) return {};
+
+    const usize first = part == 0 ? 0
+                                  : impl::lineBoundary(
+                                        text, text.size() / parts * part);
+    const usize last  = part + 1 == parts
+                            ? text.size()
+                            : impl::lineBoundary(
+                                 text, text.size() / parts * (part + 1));
+
+    return text.substr(first, last > first ? last - first : 0);
+}
+
+inline std::string_view takeRecord(std::string_view &text) noexcept {
+    while (!text.empty()) {
+        const usize cut  = text.find(utils::LF);
+        const usize size = cut == std::string_view::npos ? text.size() : cut;
+
+        const std::string_view line = text.substr(0, size);
+        text.remove_prefix(size == text.size() ? size : size + 1);
+
+        for (const char chr : line) {
+            if (!impl::isSpace(chr)) return line;
+        }
+    }
+
+    return {};
+}
+
+namespace impl {
+
+inline Result<usize> readFile(std::span<char> buffer, void *user) noexcept {
+    return static_cast<fsys::FileRead *>(user)->read(buffer);
+}
+
+inline Result<const char *> findQuote(const char *src,
+                                      const char *end) noexcept {
+    const utils::U8x16 quote =
+        utils::U8x16::splat(static_cast<u8>(utils::DOUBLE_QUOTE));
+    const utils::U8x16 slash =
+        utils::U8x16::splat(static_cast<u8>(utils::BACKSLASH));
+    const utils::U8x16 control = utils::U8x16::splat(JSON_CONTROL_END);
+    const utils::U8x16 zero    = utils::U8x16::splat(0);
+
+    while (true) {
+        // Skip whole blocks of plain bytes.
+        while (static_cast<usize>(end - src) >= utils::SIMD_WIDTH) {
+            const utils::U8x16 block = utils::U8x16::load(src);
+
+            // Lanes below 0x20 survive the saturating subtraction.
+            const u32 below   = control.subSat(block).eq(zero).mask() ^ U16_MAX;
+            const u32 special = block.eq(quote).bitOr(block.eq(slash)).mask() |
+                                below;
+            if (special != 0) {
+                src += std::countr_zero(special);
+                break;
+            }
+
+            src += utils::SIMD_WIDTH;
+        }
+
+        if (src == end) return nullptr;
+
+        const u8 byte = static_cast<u8>(*src);
+        if (*src == utils::DOUBLE_QUOTE) return src;
+        if (byte < JSON_CONTROL_END) return Err::JSON_BAD_TOKEN;
+
+        if (*src == utils::BACKSLASH) {
+            if (end - src < 2) return nullptr;
+            src += 2;
+        } else {
+            ++src;
+        }
+    }
+}
+
+inline usize lineBoundary(std::string_view text, usize pos) noexcept {
+    const usize cut = text.find(utils::LF, pos);
+    return cut == std::string_view::npos ? text.size() : cut + 1;
+}
+
+} // namespace impl
+
+// StreamReader ---
+
+inline StreamReader::StreamReader(StreamSource source,
+                                  StreamConfig config) noexcept :
+    source_{ source },
+    mode_{ config.mode },
+    status_{},
+    buffer_{},
+    text_{},
+    stack_{},
+    capacity_{ config.buffer },
+    pos_{ 0 },
+    end_{ 0 },
+    base_{ 0 },
+    error_offset_{ 0 },
+    depth_{ 0 },
+    expect_{ Expect::ROOT },
+    eof_{ false },
+    newline_{ true } {
+    if (capacity_ == 0) {
+        status_ = Err::CAPACITY_EXCEEDED;
+        return;
+    }
+
+    // Unescaping bounded at the closing quote never writes past the
+    // string's own length, so the text buffer needs no slack.
+    status_ = buffer_.reserve(capacity_);
+    if (status_.ok()) status_ = text_.reserve(capacity_);
+}
+
+inline Status StreamReader::status() const noexcept { return status_; }
+
+inline u64    StreamReader::offset() const noexcept { return base_ + pos_; }
+
+inline u64    StreamReader::errorOffset() const noexcept {
+    return error_offset_;
+}
+
+inline Result<Token> StreamReader::next() noexcept {
+    if (status_.bad()) return status_.err();
+
+    while (true) {
+        if (expect_ == Expect::RECORD) {
+            expect_  = Expect::ROOT;
+            newline_ = false;
+            return make(TokenType::RECORD_END, pos_);
+        }
+
+        const bool more = skipSpace();
+
+        if (!more) {
+            if (status_.bad()) return status_.err();
+
+            // Input ending early, or an NDJSON line ending inside its
+            // record, fails with what was expected next.
+            Err err = Err::JSON_SYNTAX_EXP_VALUE;
+            switch (expect_) {
+            case Expect::ROOT:
+                if (mode_ == StreamMode::NDJSON) {
+                    expect_ = Expect::DONE;
+                    return make(TokenType::END, pos_);
+                }
+                break;
+            case Expect::DONE     : return make(TokenType::END, pos_);
+            case Expect::KEY      : [[fallthrough]];
+            case Expect::FIRST_KEY: err = Err::JSON_SYNTAX_EXP_KEY; break;
+            case Expect::COLON    : [[fallthrough]];
+            case Expect::NEXT     : err = Err::JSON_SYNTAX_EXP_SEP; break;
+            default               : break;
+            }
+
+            return fail(err, pos_);
+        }
+
+        switch (expect_) {
+        case Expect::ROOT:
+            // NDJSON records must start on a line of their own.
+            if (!newline_) return fail(Err::JSON_SYNTAX_DBL_ROOT, pos_);
+            return value();
+        case Expect::DONE       : return fail(Err::JSON_SYNTAX_DBL_ROOT, pos_);
+        case Expect::VALUE      : [[fallthrough]];
+        case Expect::FIRST_VALUE: return value();
+        case Expect::KEY        : [[fallthrough]];
+        case Expect::FIRST_KEY  : return key();
+        case Expect::NEXT       : return separator();
+        case Expect::COLON:
+            if (buffer_.data()[pos_] != utils::COLON)
+                return fail(Err::JSON_SYNTAX_EXP_SEP, pos_);
+
+            ++pos_;
+            expect_ = Expect::VALUE;
+            break;
+        case Expect::RECORD: break;
+        }
+    }
+}
+
+inline Result<Token> StreamReader::value() noexcept {
+    switch (buffer_.data()[pos_]) {
+    case utils::BRACE_OPEN  : return open(TokenType::OBJECT_BEGIN);
+    case utils::BRACKET_OPEN: return open(TokenType::ARRAY_BEGIN);
+    case utils::DOUBLE_QUOTE: return string(TokenType::STRING);
+    case utils::BRACKET_CLOSE:
+        if (expect_ == Expect::FIRST_VALUE) return close(TokenType::ARRAY_END);
+        return fail(Err::JSON_SYNTAX_EXP_VALUE, pos_);
+    case utils::BRACE_CLOSE: [[fallthrough]];
+    case utils::COLON      : [[fallthrough]];
+    case utils::COMMA      : return fail(Err::JSON_SYNTAX_EXP_VALUE, pos_);
+    default                : return scalar();
+    }
+}
+
+inline Result<Token> StreamReader::key() noexcept {
+    const char chr = buffer_.data()[pos_];
+    if (chr == utils::DOUBLE_QUOTE) return string(TokenType::KEY);
+    if (expect_ == Expect::FIRST_KEY && chr == utils::BRACE_CLOSE)
+        return close(TokenType::OBJECT_END);
+
+    return fail(Err::JSON_SYNTAX_EXP_KEY, pos_);
+}
+
+inline Result<Token> StreamReader::separator() noexcept {
+    const char chr = buffer_.data()[pos_];
+    if (chr == utils::COMMA) {
+        ++pos_;
+        expect_ = object() ? Expect::KEY : Expect::VALUE;
+        return next();
+    }
+
+    if (object() && chr == utils::BRACE_CLOSE)
+        return close(TokenType::OBJECT_END);
+    if (!object() && chr == utils::BRACKET_CLOSE)
+        return close(TokenType::ARRAY_END);
+
+    return fail(Err::JSON_SYNTAX_EXP_SEP, pos_);
+}
+
+inline Result<Token> StreamReader::string(TokenType type) noexcept {
+    while (true) {
+        const char                *body  = buffer_.data() + pos_ + 1;
+        const char                *end   = buffer_.data() + end_;
+
+        const Result<const char *> quote = impl::findQuote(body, end);
+        if (quote.bad()) return fail(quote.err(), pos_);
+
+        if (quote.val() == nullptr) {
+            if (eof_) return fail(Err::JSON_BAD_TOKEN, pos_);
+            if (end_ - pos_ == capacity_)
+                return fail(Err::CAPACITY_EXCEEDED, pos_);
+
+            fill();
+            if (status_.bad()) return status_.err();
+            continue;
+        }
+
+        const usize begin = pos_;
+        const usize size  = static_cast<usize>(quote.val() - body);
+        pos_              = begin + size + 2;
+
+        Token token       = make(type, begin);
+
+        if (std::memchr(body, utils::BACKSLASH, size) == nullptr) {
+            token.text = { body, size };
+        } else {
+            const Result<impl::StringScan> scan =
+                impl::unescapeString(body, quote.val() + 1, text_.data());
+            if (scan.bad()) return fail(scan.err(), begin);
+
+            token.text = { text_.data(), scan.val().length };
+        }
+
+        if (utils::validateUtf8(token.text).bad())
+            return fail(Err::INVALID_UTF8, begin);
+
+        expect_ = type == TokenType::KEY ? Expect::COLON : Expect::NEXT;
+        if (type != TokenType::KEY && depth_ == 0)
+            expect_ = mode_ == StreamMode::NDJSON ? Expect::RECORD
+                                                  : Expect::DONE;
+
+        return token;
+    }
+}
+
+inline Result<Token> StreamReader::scalar() noexcept {
+    usize scan = pos_;
+
+    // The token ends at the first operator, quote or whitespace.
+    while (true) {
+        const char *data = buffer_.data();
+        while (scan < end_ && !impl::isOperator(data[scan]) &&
+               !impl::isSpace(data[scan]) && data[scan] != utils::DOUBLE_QUOTE)
+            ++scan;
+
+        if (scan < end_ || eof_) break;
+        if (end_ - pos_ == capacity_) return fail(Err::CAPACITY_EXCEEDED, pos_);
+
+        const usize consumed = scan - pos_;
+        fill();
+        if (status_.bad()) return status_.err();
+
+        scan = pos_ + consumed;
+    }
+
+    const usize            begin = pos_;
+    const std::string_view text{ buffer_.data() + begin, scan - begin };
+    pos_        = scan;
+
+    Token token = make(TokenType::NUMBER, begin);
+    token.text  = text;
+
+    if (text == "true" || text == "false") {
+        token.type    = TokenType::BOOL;
+        token.boolean = text == "true";
+    } else if (text == "null") {
+        token.type = TokenType::NUL;
+    } else {
+        const Result<Number> number = impl::readNumber(text);
+        if (number.bad()) return fail(number.err(), begin);
+
+        token.number = number.val();
+    }
+
+    expect_ = Expect::NEXT;
+    if (depth_ == 0)
+        expect_ =
+            mode_ == StreamMode::NDJSON ? Expect::RECORD : Expect::DONE;
+
+    return token;
+}
+
+inline Result<Token> StreamReader::open(TokenType type) noexcept {
+    const bool object = type == TokenType::OBJECT_BEGIN;
+    if (depth_ == impl::JSON_MAX_DEPTH)
+        return fail(Err::CAPACITY_EXCEEDED, pos_);
+
+    const usize word = depth_ / impl::JSON_BLOCK;
+    const u64   bit  = u64{ 1 } << (depth_ % impl::JSON_BLOCK);
+    stack_[word]     = object ? (stack_[word] | bit) : (stack_[word] & ~bit);
+    ++depth_;
+
+    const Token token = make(type, pos_++);
+    expect_           = object ? Expect::FIRST_KEY : Expect::FIRST_VALUE;
+
+    return token;
+}
+
+inline Result<Token> StreamReader::close(TokenType type) noexcept {
+    --depth_;
+
+    const Token token = make(type, pos_++);
+    expect_           = Expect::NEXT;
+    if (depth_ == 0)
+        expect_ =
+            mode_ == StreamMode::NDJSON ? Expect::RECORD : Expect::DONE;
+
+    return token;
+}
+
+inline Token StreamReader::make(TokenType type, usize begin) noexcept {
+    return {
+        .type    = type,
+        .offset  = base_ + begin,
+        .text    = {},
+        .number  = {},
+        .boolean = false,
+    };
+}
+
+inline Err StreamReader::fail(Err err, usize pos) noexcept {
+    error_offset_ = base_ + pos;
+    status_       = err;
+    return err;
+}
+
+inline bool StreamReader::skipSpace() noexcept {
+    while (true) {
+        const char *data = buffer_.data();
+        while (pos_ < end_ && impl::isSpace(data[pos_])) {
+            if (data[pos_] == utils::LF) {
+                if (mode_ == StreamMode::NDJSON && depth_ != 0) return false;
+                newline_ = true;
+            }
+
+            ++pos_;
+        }
+
+        if (pos_ < end_) return true;
+        if (eof_ || !fill()) return false;
+    }
+}
+
+inline bool StreamReader::fill() noexcept {
+    char *data = buffer_.data();
+    if (pos_ != 0) {
+        std::memmove(data, data + pos_, end_ - pos_);
+        base_ += pos_;
+        end_  -= pos_;
+        pos_   = 0;
+    }
+
+    if (end_ == capacity_) return false;
+
+    const Result<usize> read =
+        source_.read({ data + end_, capacity_ - end_ }, source_.user);
+    if (read.bad()) {
+        eof_ = true;
+        (void)fail(read.err(), end_);
+        return false;
+    }
+
+    if (read.val() == 0) {
+        eof_ = true;
+        return false;
+    }
+
+    end_ += read.val();
+    return true;
+}
+
+inline bool StreamReader::object() const noexcept {
+    const usize top = depth_ - 1;
+    return ((stack_[top / impl::JSON_BLOCK] >> (top % impl::JSON_BLOCK)) &
+            1U) != 0;
+}
+
+// RecordSplitter ---
+
+inline RecordSplitter::RecordSplitter(StreamSource source,
+                                      usize        capacity) noexcept :
+    source_{ source },
+    status_{},
+    buffer_{},
+    capacity_{ capacity },
+    pos_{ 0 },
+    end_{ 0 },
+    base_{ 0 },
+    eof_{ false } {
+    status_ = capacity_ == 0 ? Status{ Err::CAPACITY_EXCEEDED }
+                             : buffer_.reserve(capacity_);
+}
+
+inline Status RecordSplitter::status() const noexcept { return status_; }
+
+inline Result<RecordBatch> RecordSplitter::next() noexcept {
+    if (status_.bad()) return status_.err();
+
+    char *data = buffer_.data();
+    if (pos_ != 0) {
+        std::memmove(data, data + pos_, end_ - pos_);
+        base_ += pos_;
+        end_  -= pos_;
+        pos_   = 0;
+    }
+
+    while (!eof_ && end_ < capacity_) {
+        const Result<usize> read =
+            source_.read({ data + end_, capacity_ - end_ }, source_.user);
+        if (read.bad()) {
+            status_ = read.err();
+            return status_.err();
+        }
+
+        if (read.val() == 0) eof_ = true;
+        end_ += read.val();
+    }
+
+    const std::string_view filled{ data, end_ };
+    const usize            cut = filled.rfind(utils::LF);
+
+    if (cut != std::string_view::npos) {
+        pos_ = cut + 1;
+    } else if (eof_) {
+        // The last record may lack its newline.
+        pos_ = end_;
+    } else {
+        status_ = Err::CAPACITY_EXCEEDED;
+        return status_.err();
+    }
+
+    return RecordBatch{ .text = filled.substr(0, pos_), .offset = base_ };
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_STREAM_HPP
@@ -0,0 +1,784 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_JSON_WRITER_HPP
+#define SRR_JSON_WRITER_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/fsys/file.hpp"
+#include "sierra/json/dom.hpp"
+#include "sierra/json/index.hpp"
+#include "sierra/json/parser.hpp"
+#include "sierra/json/scalar.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/char.hpp"
+#include "sierra/utils/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+inline namespace srr {
+namespace json {
+
+// Takes all of data or fails.
+using StreamWrite = Status (*)(std::span<const char> data, void *user) noexcept;
+
+struct StreamSink {
+    StreamWrite write;
+    void       *user;
+};
+
+enum class WriterMode : u8 {
+    // No whitespace at all.
+    COMPACT = 0,
+
+    // One element or member per line, nested levels indented.
+    PRETTY,
+};
+
+struct WriterConfig {
+    WriterMode mode;
+
+    // Spaces per nesting level in PRETTY mode.
+    usize      indent;
+
+    // Initial size of a growable buffer, size of the buffer ahead of a sink.
+    usize      buffer;
+};
+
+[[nodiscard]] inline WriterConfig makeWriterConfig() noexcept;
+
+// Writes through a FileWrite, which must outlive the sink.
+[[nodiscard]] inline StreamSink   makeFileSink(fsys::FileWrite &file) noexcept;
+
+namespace impl {
+
+constexpr usize            WRITER_DEFAULT_BUFFER = 64ULL * 1024ULL;
+constexpr usize            WRITER_DEFAULT_INDENT = 2;
+constexpr usize            WRITER_STACK_WORDS    = JSON_MAX_DEPTH / JSON_BLOCK;
+
+// Longest formatted number, a shortest round-trip f64 is at most 24.
+constexpr usize            WRITER_NUMBER_CHARS   = 32;
+
+// Largest reservations, one block of escaped string and one run of
+// indentation. A sink buffer holds at least both.
+constexpr usize            WRITER_ESCAPE_BLOCK =
+    utils::SIMD_WIDTH * JSON_ESCAPE_UNIT;
+constexpr usize            WRITER_INDENT_CHUNK = 64;
+constexpr usize            WRITER_MIN_BUFFER   =
+    WRITER_ESCAPE_BLOCK + WRITER_INDENT_CHUNK;
+
+constexpr u32              NIBBLE_BITS = 4;
+constexpr u32              NIBBLE_MASK = 0x0F;
+constexpr std::string_view HEX_DIGITS  = "0123456789abcdef";
+
+[[nodiscard]] inline Status writeFile(std::span<const char> data,
+                                      void                 *user) noexcept;
+
+// Letter of the two byte escape of chr, NUL when it needs \u00XX.
+[[nodiscard]] constexpr char shortEscape(char chr) noexcept;
+
+// Writes the escape sequence of chr to dst, returns its length.
+[[nodiscard]] inline usize   escapeChar(char chr, char *dst) noexcept;
+
+} // namespace impl
+
+// Serializer appending JSON text to one of three targets: a growable buffer
+// it owns, a caller-provided fixed buffer, or a fixed buffer in front of a
+// StreamSink that is handed over whenever it fills. Strings are scanned 16
+// bytes at a time and copied through whole when no byte needs escaping.
+// Integers and floats go through std::to_chars, floats in their shortest
+// round-trip form with ".0" kept on integral ones so they read back as
+// FLOAT.
+//
+// The calls must spell one root value, or one per record() for NDJSON.
+// Misuse fails with the JSON_SYNTAX_* codes or JSON_BAD_TOKEN for a stray
+// close, a full fixed buffer and nesting past JSON_MAX_DEPTH with
+// CAPACITY_EXCEEDED, and non-finite floats with INVALID_NUMBER. The first
+// error sticks until clear(). Strings are expected to be valid UTF-8 and are
+// not checked. Nothing is flushed on destruction. Not thread-safe.
+class Writer {
+public:
+    // Into a growable buffer starting at config.buffer bytes.
+    [[nodiscard]] explicit Writer(WriterConfig config) noexcept;
+    [[nodiscard]] Writer(std::span<char> buffer, WriterConfig config) noexcept;
+    [[nodiscard]] Writer(StreamSink sink, WriterConfig config) noexcept;
+
+    Writer(const Writer &writer)            = delete;
+    Writer(Writer &&writer)                 = delete;
+    Writer &operator=(const Writer &writer) = delete;
+    Writer &operator=(Writer &&writer)      = delete;
+
+    ~Writer() noexcept                      = default;
+
+    // The first error, OUT_OF_MEMORY when the buffer could not be allocated.
+    [[nodiscard]] Status           status() const noexcept;
+
+    // Buffered output, with a sink only what has not been handed over yet.
+    [[nodiscard]] std::string_view view() const noexcept;
+
+    // Bytes produced since construction or clear(), flushed ones included.
+    [[nodiscard]] u64              written() const noexcept;
+
+    // Hands the buffered output to the sink, does nothing without one.
+    [[nodiscard]] Status           flush() noexcept;
+
+    // Drops the buffered output, the error and any open containers.
+    void                           clear() noexcept;
+
+    [[nodiscard]] Status           beginObject() noexcept;
+    [[nodiscard]] Status           endObject() noexcept;
+    [[nodiscard]] Status           beginArray() noexcept;
+    [[nodiscard]] Status           endArray() noexcept;
+
+    [[nodiscard]] Status           key(std::string_view key) noexcept;
+    [[nodiscard]] Status           string(std::string_view text) noexcept;
+    [[nodiscard]] Status           number(Number number) noexcept;
+    [[nodiscard]] Status           boolean(bool value) noexcept;
+    [[nodiscard]] Status           null() noexcept;
+
+    template<NumberValue T>
+    [[nodiscard]] Status number(T value) noexcept;
+
+    // Ends the root value with a newline so that another one may follow.
+    [[nodiscard]] Status record() noexcept;
+
+private:
+    enum class Target : u8 {
+        GROWABLE = 0,
+        FIXED,
+        SINK,
+    };
+
+    enum class Expect : u8 {
+        ROOT = 0,
+        VALUE,
+        FIRST_VALUE,
+        KEY,
+        FIRST_KEY,
+        MEMBER,
+        DONE,
+    };
+
+    // Separator and indentation ahead of a value.
+    [[nodiscard]] Status prefix() noexcept;
+    [[nodiscard]] Status open(char bracket, Expect first) noexcept;
+    [[nodiscard]] Status close(char   bracket,
+                               Expect first,
+                               Expect next) noexcept;
+
+    // Moves past a finished value.
+    void                 advance() noexcept;
+
+    // Room for count more bytes, count is at most impl::WRITER_MIN_BUFFER.
+    [[nodiscard]] Status reserve(usize count) noexcept;
+    [[nodiscard]] Status put(std::string_view text) noexcept;
+    [[nodiscard]] Status newline(usize depth) noexcept;
+    [[nodiscard]] Status quoted(std::string_view text) noexcept;
+    [[nodiscard]] Err    fail(Err err) noexcept;
+
+    impl::JsonBuffer<char>                    owned_;
+    std::array<u64, impl::WRITER_STACK_WORDS> stack_;
+    StreamSink                                sink_;
+    char                                     *data_;
+    usize                                     size_;
+    usize                                     capacity_;
+    u64                                       flushed_;
+    usize                                     depth_;
+    usize                                     indent_;
+    Status                                    status_;
+    Target                                    target_;
+    WriterMode                                mode_;
+    Expect                                    expect_;
+};
+
+// Event interface shared by the serializers, Writer and BinaryWriter.
+template<typename W>
+concept ValueWriter = requires(W               &writer,
+                               std::string_view text,
+                               Number           number,
+                               bool             flag) {
+    { writer.beginObject() } -> std::same_as<Status>;
+    { writer.endObject() } -> std::same_as<Status>;
+    { writer.beginArray() } -> std::same_as<Status>;
+    { writer.endArray() } -> std::same_as<Status>;
+    { writer.key(text) } -> std::same_as<Status>;
+    { writer.string(text) } -> std::same_as<Status>;
+    { writer.number(number) } -> std::same_as<Status>;
+    { writer.boolean(flag) } -> std::same_as<Status>;
+    { writer.null() } -> std::same_as<Status>;
+};
+
+// Serializes a whole value.
+template<ValueWriter W>
+[[nodiscard]] Status write(W &writer, const Element &element) noexcept;
+
+template<ValueWriter W>
+[[nodiscard]] Status write(W                 &writer,
+                           const DomDocument &document,
+                           const DomValue    &value) noexcept;
+
+inline WriterConfig makeWriterConfig() noexcept {
+    return {
+        .mode   = WriterMode::COMPACT,
+        .indent = impl::WRITER_DEFAULT_INDENT,
+        .buffer = impl::WRITER_DEFAULT_BUFFER,
+    };
+}
+
+inline StreamSink makeFileSink(fsys::FileWrite &file) noexcept {
+    return { .write = impl::writeFile, .user = &file };
+}
+
+namespace impl {
+
+inline Status writeFile(std::span<const char> data, void *user) noexcept {
+    return static_cast<fsys::FileWrite *>(user)->write(data);
+}
+
+constexpr char shortEscape(char chr) noexcept {
+    switch (chr) {
+    case utils::DOUBLE_QUOTE: return utils::DOUBLE_QUOTE;
+    case utils::BACKSLASH   : return utils::BACKSLASH;
+    case utils::BS          : return utils::B;
+    case utils::FF          : return utils::F;
+    case utils::LF          : return utils::N;
+    case utils::CR          : return utils::R;
+    case utils::HT          : return utils::T;
+    default                 : return utils::NUL;
+    }
+}
+
+inline usize escapeChar(char chr, char *dst) noexcept {
+    const char code = shortEscape(chr);
+
+    dst[0]          = utils::BACKSLASH;
+    if (code != utils::NUL) {
+        dst[1] = code;
+        return JSON_ESCAPE_SHORT;
+    }
+
+    // Only control characters get here, the high byte is always zero.
+    const u32 byte = static_cast<u8>(chr);
+    dst[1]         = utils::U;
+    dst[2]         = utils::NUM_0;
+    dst[3]         = utils::NUM_0;
+    dst[4]         = HEX_DIGITS[byte >> NIBBLE_BITS];
+    dst[5]         = HEX_DIGITS[byte & NIBBLE_MASK];
+    return JSON_ESCAPE_UNIT;
+}
+
+} // namespace impl
+
+// Writer ---
+
+inline Writer::Writer(WriterConfig config) noexcept :
+    Writer{ std::span<char>{}, config } {
+    target_ = Target::GROWABLE;
+
+    const Status reserved = owned_.reserve(config.buffer);
+    if (reserved.bad()) {
+        status_ = reserved;
+        return;
+    }
+
+    data_     = owned_.data();
+    capacity_ = owned_.capacity();
+}
+
+inline Writer::Writer(std::span<char> buffer, WriterConfig config) noexcept :
+    stack_{},
+    sink_{ .write = nullptr, .user = nullptr },
+    data_{ buffer.data() },
+    size_{ 0 },
+    capacity_{ buffer.size() },
+    flushed_{ 0 },
+    depth_{ 0 },
+    indent_{ config.indent },
+    status_{},
+    target_{ Target::FIXED },
+    mode_{ config.mode },
+    expect_{ Expect::ROOT } {}
+
+inline Writer::Writer(StreamSink sink, WriterConfig config) noexcept :
+    Writer{ std::span<char>{}, config } {
+    target_ = Target::SINK;
+    sink_   = sink;
+
+    const Status reserved =
+        owned_.reserve(std::max(config.buffer, impl::WRITER_MIN_BUFFER));
+    if (reserved.bad()) {
+        status_ = reserved;
+        return;
+    }
+
+    data_     = owned_.data();
+    capacity_ = owned_.capacity();
+}
+
+inline Status Writer::status() const noexcept { return status_; }
+
+inline std::string_view Writer::view() const noexcept {
+    return { data_, size_ };
+}
+
+inline u64 Writer::written() const noexcept { return flushed_ + size_; }
+
+inline Status Writer::flush() noexcept {
+    if (target_ != Target::SINK || size_ == 0) return status_;
+
+    const Status handed = sink_.write({ data_, size_ }, sink_.user);
+    if (handed.bad()) return fail(handed.err());
+
+    flushed_ += size_;
+    size_     = 0;
+    return status_;
+}
+
+inline void Writer::clear() noexcept {
+    size_    = 0;
+    flushed_ = 0;
+    depth_   = 0;
+    expect_  = Expect::ROOT;
+
+    // A growable or sink writer that never got its buffer stays failed.
+    if (target_ == Target::FIXED || data_ != nullptr) status_ = {};
+}
+
+inline Status Writer::beginObject() noexcept {
+    return open(utils::BRACE_OPEN, Expect::FIRST_KEY);
+}
+
+inline Status Writer::endObject() noexcept {
+    return close(utils::BRACE_CLOSE, Expect::FIRST_KEY, Expect::KEY);
+}
+
+inline Status Writer::beginArray() noexcept {
+    return open(utils::BRACKET_OPEN, Expect::FIRST_VALUE);
+}
+
+inline Status Writer::endArray() noexcept {
+    return close(utils::BRACKET_CLOSE, Expect::FIRST_VALUE, Expect::VALUE);
+}
+
+inline Status Writer::key(std::string_view key) noexcept {
+    if (status_.bad()) return status_;
+
+    if (expect_ != Expect::KEY && expect_ != Expect::FIRST_KEY)
+        return fail(expect_ == Expect::DONE ? Err::JSON_SYNTAX_DBL_ROOT
+                                            : Err::JSON_SYNTAX_EXP_VALUE);
+
+    if (expect_ == Expect::KEY) {
+        const Status comma = put(",");
+        if (comma.bad()) return comma;
+    }
+
+    const Status line = newline(depth_);
+    if (line.bad()) return line;
+
+    const Status text = quoted(key);
+    if (text.bad()) return text;
+
+    expect_ = Expect::MEMBER;
+    return put(mode_ == WriterMode::PRETTY ? ": " : ":");
+}
+
+inline Status Writer::string(std::string_view text) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    const Status body = quoted(text);
+    if (body.bad()) return body;
+
+    advance();
+    return {};
+}
+
+inline Status Writer::number(Number number) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    std::array<char, impl::WRITER_NUMBER_CHARS> buf{};
+    char *const          first = buf.data();
+    char *const          last  = first + buf.size();
+    std::to_chars_result res{};
+
+    switch (number.type) {
+    case NumberType::INT:
+        res = std::to_chars(first, last, std::bit_cast<i64>(number.bits));
+        break;
+    case NumberType::UINT: res = std::to_chars(first, last, number.bits); break;
+    case NumberType::FLOAT: {
+        const f64 value = std::bit_cast<f64>(number.bits);
+        if (!std::isfinite(value)) return fail(Err::INVALID_NUMBER);
+
+        res = std::to_chars(first, last, value);
+
+        // Keep integral floats floats when read back.
+        const std::string_view text{ first,
+                                     static_cast<usize>(res.ptr - first) };
+        if (text.find_first_of(".e") == std::string_view::npos) {
+            *res.ptr++ = utils::DOT;
+            *res.ptr++ = utils::NUM_0;
+        }
+        break;
+    }
+    }
+
+    const Status text = put({ first, static_cast<usize>(res.ptr - first) });
+    if (text.bad()) return text;
+
+    advance();
+    return {};
+}
+
+inline Status Writer::boolean(bool value) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    const Status text = put(value ? "true" : "false");
+    if (text.bad()) return text;
+
+    advance();
+    return {};
+}
+
+inline Status Writer::null() noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    const Status text = put("null");
+    if (text.bad()) return text;
+
+    advance();
+    return {};
+}
+
+template<NumberValue T>
+Status Writer::number(T value) noexcept {
+    return number(makeNumber(value));
+}
+
+inline Status Writer::record() noexcept {
+    if (status_.bad()) return status_;
+    if (expect_ != Expect::DONE) return fail(Err::JSON_SYNTAX_EXP_VALUE);
+
+    expect_ = Expect::ROOT;
+    return put("\n");
+}
+
+inline Status Writer::prefix() noexcept {
+    if (status_.bad()) return status_;
+
+    switch (expect_) {
+    case Expect::ROOT       : [[fallthrough]];
+    case Expect::MEMBER     : return {};
+    case Expect::FIRST_VALUE: return newline(depth_);
+    case Expect::VALUE      : {
+        const Status comma = put(",");
+        if (comma.bad()) return comma;
+
+        return newline(depth_);
+    }
+    case Expect::KEY      : [[fallthrough]];
+    case Expect::FIRST_KEY: return fail(Err::JSON_SYNTAX_EXP_KEY);
+    case Expect::DONE     : return fail(Err::JSON_SYNTAX_DBL_ROOT);
+    }
+
+    return {};
+}
+
+inline Status Writer::open(char bracket, Expect first) noexcept {
+    const Status prefixed = prefix();
+    if (prefixed.bad()) return prefixed;
+
+    if (depth_ == impl::JSON_MAX_DEPTH) return fail(Err::CAPACITY_EXCEEDED);
+
+    const Status text = put({ &bracket, 1 });
+    if (text.bad()) return text;
+
+    const usize word = depth_ / impl::JSON_BLOCK;
+    const u64   bit  = u64{ 1 } << (depth_ % impl::JSON_BLOCK);
+    stack_[word]     = first == Expect::FIRST_KEY ? (stack_[word] | bit)
+                                                  : (stack_[word] & ~bit);
+    ++depth_;
+
+    expect_ = first;
+    return {};
+}
+
+inline Status Writer::close(char bracket, Expect first, Expect next) noexcept {
+    if (status_.bad()) return status_;
+
+    if (expect_ != first && expect_ != next)
+        return fail(expect_ == Expect::MEMBER ? Err::JSON_SYNTAX_EXP_VALUE
+                                              : Err::JSON_BAD_TOKEN);
+
+    --depth_;
+
+    // Empty containers stay on one line.
+    if (expect_ == next) {
+        const Status line = newline(depth_);
+        if (line.bad()) return line;
+    }
+
+    const Status text = put({ &bracket, 1 });
+    if (text.bad()) return text;
+
+    advance();
+    return {};
+}
+
+inline void Writer::advance() noexcept {
+    if (depth_ == 0) {
+        expect_ = Expect::DONE;
+        return;
+    }
+
+    const usize top    = depth_ - 1;
+    const bool  object = ((stack_[top / impl::JSON_BLOCK] >>
+                          (top % impl::JSON_BLOCK)) &
+                         1U) != 0;
+    expect_            = object ? Expect::KEY : Expect::VALUE;
+}
+
+inline Status Writer::reserve(usize count) noexcept {
+    if (capacity_ - size_ >= count) return {};
+
+    switch (target_) {
+    case Target::GROWABLE: {
+        const Status reserved = owned_.reserve(size_ + count);
+        if (reserved.bad()) return fail(reserved.err());
+
+        data_     = owned_.data();
+        capacity_ = owned_.capacity();
+        return {};
+    }
+    case Target::FIXED: return fail(Err::CAPACITY_EXCEEDED);
+    case Target::SINK : return flush();
+    }
+
+    return {};
+}
+
+inline Status Writer::put(std::string_view text) noexcept {
+    const Status reserved = reserve(text.size());
+    if (reserved.bad()) return reserved;
+
+    std::memcpy(data_ + size_, text.data(), text.size());
+    size_ += text.size();
+    return {};
+}
+
+inline Status Writer::newline(usize depth) noexcept {
+    if (mode_ == WriterMode::COMPACT) return {};
+
+    const Status line = put("\n");
+    if (line.bad()) return line;
+
+    usize spaces = depth * indent_;
+    while (spaces > 0) {
+        const usize  run      = std::min(spaces, impl::WRITER_INDENT_CHUNK);
+        const Status reserved = reserve(run);
+        if (reserved.bad()) return reserved;
+
+        std::memset(data_ + size_, utils::SPACE, run);
+        size_  += run;
+        spaces -= run;
+    }
+
+    return {};
+}
+
+inline Status Writer::quoted(std::string_view text) noexcept {
+    const Status open = put("\"");
+    if (open.bad()) return open;
+
+    const utils::U8x16 quote =
+        utils::U8x16::splat(static_cast<u8>(utils::DOUBLE_QUOTE));
+    const utils::U8x16 slash =
+        utils::U8x16::splat(static_cast<u8>(utils::BACKSLASH));
+    const utils::U8x16 control =
+        utils::U8x16::splat(static_cast<u8>(impl::JSON_CONTROL_END - 1));
+    const utils::U8x16 zero = utils::U8x16::splat(0);
+
+    const char        *src  = text.data();
+    const char *const  end  = src + text.size();
+
+    while (static_cast<usize>(end - src) >= utils::SIMD_WIDTH) {
+        if (capacity_ - size_ < impl::WRITER_ESCAPE_BLOCK) {
+            // Near the end of a fixed buffer, finish with exact fits.
+            if (target_ == Target::FIXED) break;
+
+            const Status reserved = reserve(impl::WRITER_ESCAPE_BLOCK);
+            if (reserved.bad()) return reserved;
+        }
+
+        const utils::U8x16 in = utils::U8x16::load(src);
+        in.store(data_ + size_);
+
+        u32 mask = in.eq(quote)
+                       .bitOr(in.eq(slash))
+                       .bitOr(in.subSat(control).eq(zero))
+                       .mask();
+
+        if (mask == 0) {
+            size_ += utils::SIMD_WIDTH;
+            src   += utils::SIMD_WIDTH;
+            continue;
+        }
+
+        // The clean prefix is already in place, rewrite from the first hit.
+        usize done  = static_cast<usize>(std::countr_zero(mask));
+        size_      += done;
+        while (mask != 0) {
+            const usize hit = static_cast<usize>(std::countr_zero(mask));
+            std::memcpy(data_ + size_, src + done, hit - done);
+            size_ += hit - done;
+            size_ += impl::escapeChar(src[hit], data_ + size_);
+            done   = hit + 1;
+            mask  &= mask - 1;
+        }
+
+        std::memcpy(data_ + size_, src + done, utils::SIMD_WIDTH - done);
+        size_ += utils::SIMD_WIDTH - done;
+        src   += utils::SIMD_WIDTH;
+    }
+
+    for (; src != end; ++src) {
+        std::array<char, impl::JSON_ESCAPE_UNIT> unit{ *src };
+        usize                                    length = 1;
+        if (static_cast<u8>(*src) < impl::JSON_CONTROL_END ||
+            *src == utils::DOUBLE_QUOTE || *src == utils::BACKSLASH)
+            length = impl::escapeChar(*src, unit.data());
+
+        const Status put_unit = put({ unit.data(), length });
+        if (put_unit.bad()) return put_unit;
+    }
+
+    return put("\"");
+}
+
+inline Err Writer::fail(Err err) noexcept {
+    status_ = err;
+    return err;
+}
+
+template<ValueWriter W>
+Status write(W &writer, const Element &element) noexcept {
+    switch (element.type()) {
+    case Type::NUL   : return writer.null();
+    case Type::BOOL  : return writer.boolean(element.getBool().val());
+    case Type::NUMBER: return writer.number(element.getNumber().val());
+    case Type::STRING: return writer.string(element.getString().val());
+    case Type::ARRAY : {
+        const Status opened = writer.beginArray();
+        if (opened.bad()) return opened;
+
+        for (const Element child : element) {
+            const Status written = write(writer, child);
+            if (written.bad()) return written;
+        }
+
+        return writer.endArray();
+    }
+    case Type::OBJECT: {
+        const Status opened = writer.beginObject();
+        if (opened.bad()) return opened;
+
+        for (MemberIter it = element.membersBegin(); it != element.membersEnd();
+             ++it) {
+            const Member member = *it;
+
+            const Status key    = writer.key(member.key);
+            if (key.bad()) return key;
+
+            const Status written = write(writer, member.value);
+            if (written.bad()) return written;
+        }
+
+        return writer.endObject();
+    }
+    }
+
+    return {};
+}
+
+template<ValueWriter W>
+Status write(W                 &writer,
+             const DomDocument &document,
+             const DomValue    &value) noexcept {
+    switch (value.type()) {
+    case Type::NUL   : return writer.null();
+    case Type::BOOL  : return writer.boolean(value.getBool().val());
+    case Type::NUMBER: return writer.number(value.getNumber().val());
+    case Type::STRING: return writer.string(value.getString().val());
+    case Type::ARRAY : {
+        const Status opened = writer.beginArray();
+        if (opened.bad()) return opened;
+
+        for (const DomValue &child : value.elements()) {
+            const Status written = write(writer, document, child);
+            if (written.bad()) return written;
+        }
+
+        return writer.endArray();
+    }
+    case Type::OBJECT: {
+        const Status opened = writer.beginObject();
+        if (opened.bad()) return opened;
+
+        for (const DomMember &member : value.members()) {
+            const Status key = writer.key(document.key(member.key));
+            if (key.bad()) return key;
+
+            const Status written = write(writer, document, member.value);
+            if (written.bad()) return written;
+        }
+
+        return writer.endObject();
+    }
+    }
+
+    return {};
+}
+
+} // namespace json
+} // namespace srr
+
+#endif // SRR_JSON_WRITER_HPP
@@ -68,6 +68,8 @@ struct ResultStorage<T &> {
 
     static void construct(Type &slot, T &value) noexcept { slot = &value; }
 
+    static void construct(Type &slot, Type other) noexcept { slot = other; }
+
     static void destroy([[maybe_unused]] Type &slot) noexcept {}
 
     static T   &access(Type slot) noexcept { return *slot; }
@@ -91,7 +93,7 @@ public:
     [[nodiscard]] constexpr Result(T &&value) noexcept;
 
     [[nodiscard]] constexpr Result(const T &value) noexcept
-        requires utils::SafeCopyable<T>;
+        requires utils::SafeCopyable<T> && (!std::is_reference_v<T>);
 
     [[nodiscard]] constexpr Result(Result &&result) noexcept;
     [[nodiscard]] constexpr Result(const Result &result) noexcept
@@ -141,12 +143,12 @@ constexpr Result<T>::Result(Err err) noexcept : ok_{ false }, data_{} {
 
 template<ResultStorable T>
 constexpr Result<T>::Result(T &&value) noexcept : ok_{ true }, data_{} {
-    Storage::construct(data_.value, std::move(value));
+    Storage::construct(data_.value, std::forward<T>(value));
 }
 
 template<ResultStorable T>
 constexpr Result<T>::Result(const T &value) noexcept
-    requires utils::SafeCopyable<T>
+    requires utils::SafeCopyable<T> && (!std::is_reference_v<T>)
     : ok_{ true }, data_{} {
     Storage::construct(data_.value, value);
 }
@@ -203,7 +205,7 @@ constexpr const T &Result<T>::val() const & noexcept {
 
 template<ResultStorable T>
 constexpr T &&Result<T>::val() && noexcept {
-    return std::move(Storage::access(data_.value));
+    return std::forward<T>(Storage::access(data_.value));
 }
 
 template<ResultStorable T>
@@ -55,6 +55,34 @@
     #error "Unknown target is not supported!"
 #endif // SRR_TARGET_UNKNOWN
 
+#if defined(__x86_64__) || defined(_M_X64)
+    #define SRR_ARCH_X86_64
+#endif // __x86_64__ || _M_X64
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define SRR_ARCH_ARM64
+#endif // __aarch64__ || _M_ARM64
+
+#ifdef SRR_ARCH_X86_64
+    #define SRR_SIMD_SSE2
+
+    #ifdef __SSSE3__
+        #define SRR_SIMD_SSSE3
+    #endif // __SSSE3__
+
+    #ifdef __SSE4_2__
+        #define SRR_SIMD_SSE42
+    #endif // __SSE4_2__
+#endif // SRR_ARCH_X86_64
+
+#ifdef SRR_ARCH_ARM64
+    #define SRR_SIMD_NEON
+
+    #ifdef __ARM_FEATURE_CRC32
+        #define SRR_SIMD_CRC32
+    #endif // __ARM_FEATURE_CRC32
+#endif // SRR_ARCH_ARM64
+
 #ifdef SRR_TARGET_UNIX
 
     #include "sierra/prims.hpp"
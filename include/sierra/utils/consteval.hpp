@@ -31,22 +31,27 @@
 #define SRR_UTILS_CONSTEVAL_HPP
 
 #include "sierra/prims.hpp"
+#include "sierra/utils/hash.hpp"
 
+#include <string_view>
 #include <utility>
 
 inline namespace srr {
 namespace utils {
 
+[[nodiscard]] consteval u64 constHash(std::string_view str) noexcept;
+
 template<usize N, typename F, usize... I>
-static consteval void callEachIndex(
+static constexpr void callEachIndex(
     // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
     F                                        &&func,
     [[maybe_unused]] std::index_sequence<I...> seq) noexcept {
     (func.template operator()<I>(), ...);
 }
 
+// Also usable at runtime, per-index code generation over packs relies on it.
 template<usize N, typename F>
-consteval void forEachIndex(F &&func) noexcept {
+constexpr void forEachIndex(F &&func) noexcept {
     callEachIndex<N>(std::forward<F>(func), std::make_index_sequence<N>{});
 }
 
@@ -78,6 +83,8 @@ consteval void forEachAdj(F &&func) noexcept {
     }
 }
 
+consteval u64 constHash(std::string_view str) noexcept { return hash64(str); }
+
 } // namespace utils
 } // namespace srr
 
@@ -0,0 +1,539 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_UTILS_HASH_HPP
+#define SRR_UTILS_HASH_HPP
+
+#include "sierra/prims.hpp"
+#include "sierra/target.hpp"
+
+#if defined(SRR_SIMD_SSE42)
+    #include <nmmintrin.h>
+#elif defined(SRR_SIMD_CRC32)
+    #include <arm_acle.h>
+#endif // SRR_SIMD_SSE42
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string_view>
+#include <type_traits>
+
+inline namespace srr {
+namespace utils {
+
+struct Hash128 {
+    u64                          low;
+    u64                          high;
+
+    [[nodiscard]] constexpr bool operator==(const Hash128 &rhs) const noexcept =
+        default;
+};
+
+namespace impl {
+
+constexpr u32   CRC32C_POLY    = 0x82F6'3B78;
+constexpr u32   CRC32C_INIT    = U32_MAX;
+constexpr usize CRC32C_SLICES  = 8;
+constexpr usize CRC32C_ENTRIES = 256;
+
+constexpr u64   XXH_PRIME_1    = 0x9E37'79B1'85EB'CA87;
+constexpr u64   XXH_PRIME_2    = 0xC2B2'AE3D'27D4'EB4F;
+constexpr u64   XXH_PRIME_3    = 0x1656'67B1'9E37'79F9;
+constexpr u64   XXH_PRIME_4    = 0x85EB'CA77'C2B2'AE63;
+constexpr u64   XXH_PRIME_5    = 0x27D4'EB2F'1656'67C5;
+constexpr usize XXH_STRIPE     = 32;
+constexpr i32   XXH_ROUND_ROT  = 31;
+constexpr i32   XXH_LANE_ROT_1 = 1;
+constexpr i32   XXH_LANE_ROT_2 = 7;
+constexpr i32   XXH_LANE_ROT_3 = 12;
+constexpr i32   XXH_LANE_ROT_4 = 18;
+constexpr i32   XXH_TAIL_ROT_8 = 27;
+constexpr i32   XXH_TAIL_ROT_4 = 23;
+constexpr i32   XXH_TAIL_ROT_1 = 11;
+constexpr u32   XXH_AVAL_1     = 33;
+constexpr u32   XXH_AVAL_2     = 29;
+constexpr u32   XXH_AVAL_3     = 32;
+
+constexpr u64   MUR_C1         = 0x87C3'7B91'1142'53D5;
+constexpr u64   MUR_C2         = 0x4CF5'AD43'2745'937F;
+constexpr u64   MUR_ADD_1      = 0x52DC'E729;
+constexpr u64   MUR_ADD_2      = 0x3849'5AB5;
+constexpr u64   MUR_MUL        = 5;
+constexpr u64   MUR_FMIX_1     = 0xFF51'AFD7'ED55'8CCD;
+constexpr u64   MUR_FMIX_2     = 0xC4CE'B9FE'1A85'EC53;
+constexpr u32   MUR_FMIX_SHIFT = 33;
+constexpr usize MUR_BLOCK      = 16;
+constexpr i32   MUR_K1_ROT     = 31;
+constexpr i32   MUR_K2_ROT     = 33;
+constexpr i32   MUR_H1_ROT     = 27;
+constexpr i32   MUR_H2_ROT     = 31;
+
+constexpr u32   BYTE_BITS      = 8;
+
+using CrcTables = std::array<std::array<u32, CRC32C_ENTRIES>, CRC32C_SLICES>;
+
+[[nodiscard]] consteval CrcTables makeCrcTables() noexcept;
+
+[[nodiscard]] static constexpr u64 readU64(const char *ptr) noexcept;
+[[nodiscard]] static constexpr u32 readU32(const char *ptr) noexcept;
+[[nodiscard]] static constexpr u8  readU8(const char *ptr) noexcept;
+
+[[nodiscard]] static constexpr u32 crcSoftware(u32         crc,
+                                               const char *ptr,
+                                               usize       len) noexcept;
+[[nodiscard]] static u32           crcHardware(u32         crc,
+                                               const char *ptr,
+                                               usize       len) noexcept;
+
+[[nodiscard]] static constexpr u64 xxhRound(u64 acc, u64 input) noexcept;
+[[nodiscard]] static constexpr u64 xxhMerge(u64 acc, u64 val) noexcept;
+[[nodiscard]] static constexpr u64 murMix(u64 key) noexcept;
+
+} // namespace impl
+
+[[nodiscard]] constexpr u64     mix64(u64 val) noexcept;
+
+[[nodiscard]] constexpr u32     crc32c(std::string_view data) noexcept;
+
+[[nodiscard]] constexpr u64     hash64(std::string_view data) noexcept;
+[[nodiscard]] constexpr u64     hash64(std::string_view data,
+                                       u64              seed) noexcept;
+
+[[nodiscard]] constexpr Hash128 hash128(std::string_view data) noexcept;
+[[nodiscard]] constexpr Hash128 hash128(std::string_view data,
+                                        u64              seed) noexcept;
+
+// CRC-32C (Castagnoli), hardware accelerated outside constant evaluation
+class Crc32c {
+public:
+    [[nodiscard]] constexpr Crc32c() noexcept;
+
+    constexpr void              update(std::string_view data) noexcept;
+
+    [[nodiscard]] constexpr u32 digest() const noexcept;
+
+private:
+    u32 state_;
+};
+
+// XXH64 compatible 64-bit hash
+class Hasher64 {
+public:
+    [[nodiscard]] constexpr Hasher64() noexcept;
+    [[nodiscard]] constexpr explicit Hasher64(u64 seed) noexcept;
+
+    constexpr void              update(std::string_view data) noexcept;
+
+    [[nodiscard]] constexpr u64 digest() const noexcept;
+
+private:
+    constexpr void                         consume(const char *ptr) noexcept;
+
+    std::array<u64, 4>                     lanes_;
+    std::array<char, impl::XXH_STRIPE>     buffer_;
+    usize                                  buffered_;
+    u64                                    total_;
+    u64                                    seed_;
+};
+
+// MurmurHash3 x64_128 compatible 128-bit hash
+class Hasher128 {
+public:
+    [[nodiscard]] constexpr Hasher128() noexcept;
+    [[nodiscard]] constexpr explicit Hasher128(u64 seed) noexcept;
+
+    constexpr void                  update(std::string_view data) noexcept;
+
+    [[nodiscard]] constexpr Hash128 digest() const noexcept;
+
+private:
+    constexpr void                        consume(const char *ptr) noexcept;
+
+    u64                                   h1_;
+    u64                                   h2_;
+    std::array<char, impl::MUR_BLOCK>     buffer_;
+    usize                                 buffered_;
+    u64                                   total_;
+};
+
+namespace impl {
+
+consteval CrcTables makeCrcTables() noexcept {
+    CrcTables tables{};
+
+    for (usize i = 0; i < CRC32C_ENTRIES; ++i) {
+        u32 crc = static_cast<u32>(i);
+        for (u32 bit = 0; bit < BYTE_BITS; ++bit)
+            crc = (crc & 1U) != 0 ? (crc >> 1U) ^ CRC32C_POLY : crc >> 1U;
+        tables[0][i] = crc;
+    }
+
+    for (usize i = 0; i < CRC32C_ENTRIES; ++i) {
+        for (usize slice = 1; slice < CRC32C_SLICES; ++slice) {
+            const u32 prev   = tables[slice - 1][i];
+            tables[slice][i] = (prev >> BYTE_BITS) ^ tables[0][prev & U8_MAX];
+        }
+    }
+
+    return tables;
+}
+
+constexpr CrcTables CRC32C_TABLES = makeCrcTables();
+
+static constexpr u64 readU64(const char *ptr) noexcept {
+    u64 val = 0;
+    for (u32 i = 0; i < sizeof(u64); ++i)
+        val |= static_cast<u64>(static_cast<u8>(ptr[i])) << (i * BYTE_BITS);
+    return val;
+}
+
+static constexpr u32 readU32(const char *ptr) noexcept {
+    u32 val = 0;
+    for (u32 i = 0; i < sizeof(u32); ++i)
+        val |= static_cast<u32>(static_cast<u8>(ptr[i])) << (i * BYTE_BITS);
+    return val;
+}
+
+static constexpr u8 readU8(const char *ptr) noexcept {
+    return static_cast<u8>(*ptr);
+}
+
+static constexpr u32 crcSoftware(u32 crc, const char *ptr, usize len) noexcept {
+    usize pos = 0;
+
+    for (; pos + sizeof(u64) <= len; pos += sizeof(u64)) {
+        const u64 word = readU64(ptr + pos) ^ crc;
+
+        u32       next = 0;
+        for (usize i = 0; i < sizeof(u64); ++i) {
+            const u64 byte  = (word >> (i * BYTE_BITS)) & U8_MAX;
+            next           ^= CRC32C_TABLES[CRC32C_SLICES - 1 - i][byte];
+        }
+        crc = next;
+    }
+
+    for (; pos < len; ++pos)
+        crc = (crc >> BYTE_BITS) ^ CRC32C_TABLES[0][(crc ^ readU8(ptr + pos)) &
+                                                    U8_MAX];
+
+    return crc;
+}
+
+static u32 crcHardware(u32 crc, const char *ptr, usize len) noexcept {
+#if defined(SRR_SIMD_SSE42)
+    usize pos  = 0;
+    u64   wide = crc;
+
+    for (; pos + sizeof(u64) <= len; pos += sizeof(u64))
+        wide = _mm_crc32_u64(wide, readU64(ptr + pos));
+
+    crc = static_cast<u32>(wide);
+    for (; pos < len; ++pos) crc = _mm_crc32_u8(crc, readU8(ptr + pos));
+
+    return crc;
+#elif defined(SRR_SIMD_CRC32)
+    usize pos = 0;
+
+    for (; pos + sizeof(u64) <= len; pos += sizeof(u64))
+        crc = __crc32cd(crc, readU64(ptr + pos));
+
+    for (; pos < len; ++pos) crc = __crc32cb(crc, readU8(ptr + pos));
+
+    return crc;
+#else  // SRR_SIMD_SSE42
+    return crcSoftware(crc, ptr, len);
+#endif // SRR_SIMD_SSE42
+}
+
+static constexpr u64 xxhRound(u64 acc, u64 input) noexcept {
+    acc += input * XXH_PRIME_2;
+    acc  = std::rotl(acc, XXH_ROUND_ROT);
+    return acc * XXH_PRIME_1;
+}
+
+static constexpr u64 xxhMerge(u64 acc, u64 val) noexcept {
+    acc ^= xxhRound(0, val);
+    return (acc * XXH_PRIME_1) + XXH_PRIME_4;
+}
+
+static constexpr u64 murMix(u64 key) noexcept {
+    key ^= key >> MUR_FMIX_SHIFT;
+    key *= MUR_FMIX_1;
+    key ^= key >> MUR_FMIX_SHIFT;
+    key *= MUR_FMIX_2;
+    key ^= key >> MUR_FMIX_SHIFT;
+    return key;
+}
+
+} // namespace impl
+
+constexpr Crc32c::Crc32c() noexcept : state_{ impl::CRC32C_INIT } {}
+
+constexpr void Crc32c::update(std::string_view data) noexcept {
+    if (std::is_constant_evaluated())
+        state_ = impl::crcSoftware(state_, data.data(), data.size());
+    else
+        state_ = impl::crcHardware(state_, data.data(), data.size());
+}
+
+constexpr u32 Crc32c::digest() const noexcept {
+    return state_ ^ impl::CRC32C_INIT;
+}
+
+constexpr Hasher64::Hasher64() noexcept : Hasher64{ 0 } {}
+
+constexpr Hasher64::Hasher64(u64 seed) noexcept :
+    lanes_{ seed + impl::XXH_PRIME_1 + impl::XXH_PRIME_2,
+            seed + impl::XXH_PRIME_2,
+            seed,
+            seed - impl::XXH_PRIME_1 },
+    buffer_{},
+    buffered_{ 0 },
+    total_{ 0 },
+    seed_{ seed } {}
+
+constexpr void Hasher64::update(std::string_view data) noexcept {
+    const char *ptr  = data.data();
+    usize       len  = data.size();
+
+    total_          += len;
+
+    if (buffered_ != 0) {
+        const usize fill = std::min(len, impl::XXH_STRIPE - buffered_);
+        for (usize i = 0; i < fill; ++i) buffer_[buffered_ + i] = ptr[i];
+
+        buffered_ += fill;
+        ptr       += fill;
+        len       -= fill;
+
+        if (buffered_ < impl::XXH_STRIPE) return;
+
+        consume(buffer_.data());
+        buffered_ = 0;
+    }
+
+    for (; len >= impl::XXH_STRIPE; len -= impl::XXH_STRIPE) {
+        consume(ptr);
+        ptr += impl::XXH_STRIPE;
+    }
+
+    for (usize i = 0; i < len; ++i) buffer_[i] = ptr[i];
+    buffered_ = len;
+}
+
+constexpr u64 Hasher64::digest() const noexcept {
+    u64 hash = 0;
+
+    if (total_ >= impl::XXH_STRIPE) {
+        hash = std::rotl(lanes_[0], impl::XXH_LANE_ROT_1) +
+               std::rotl(lanes_[1], impl::XXH_LANE_ROT_2) +
+               std::rotl(lanes_[2], impl::XXH_LANE_ROT_3) +
+               std::rotl(lanes_[3], impl::XXH_LANE_ROT_4);
+
+        for (const u64 lane : lanes_) hash = impl::xxhMerge(hash, lane);
+    } else {
+        hash = seed_ + impl::XXH_PRIME_5;
+    }
+
+    hash             += total_;
+
+    const char *ptr   = buffer_.data();
+    usize       len   = buffered_;
+
+    for (; len >= sizeof(u64); len -= sizeof(u64)) {
+        hash ^= impl::xxhRound(0, impl::readU64(ptr));
+        hash  = (std::rotl(hash, impl::XXH_TAIL_ROT_8) * impl::XXH_PRIME_1) +
+               impl::XXH_PRIME_4;
+        ptr += sizeof(u64);
+    }
+
+    if (len >= sizeof(u32)) {
+        hash ^= impl::readU32(ptr) * impl::XXH_PRIME_1;
+        hash  = (std::rotl(hash, impl::XXH_TAIL_ROT_4) * impl::XXH_PRIME_2) +
+               impl::XXH_PRIME_3;
+        ptr += sizeof(u32);
+        len -= sizeof(u32);
+    }
+
+    for (; len > 0; --len) {
+        hash ^= impl::readU8(ptr) * impl::XXH_PRIME_5;
+        hash  = std::rotl(hash, impl::XXH_TAIL_ROT_1) * impl::XXH_PRIME_1;
+        ++ptr;
+    }
+
+    hash ^= hash >> impl::XXH_AVAL_1;
+    hash *= impl::XXH_PRIME_2;
+    hash ^= hash >> impl::XXH_AVAL_2;
+    hash *= impl::XXH_PRIME_3;
+    hash ^= hash >> impl::XXH_AVAL_3;
+
+    return hash;
+}
+
+constexpr void Hasher64::consume(const char *ptr) noexcept {
+    for (usize i = 0; i < lanes_.size(); ++i)
+        lanes_[i] = impl::xxhRound(lanes_[i],
+                                   impl::readU64(ptr + (i * sizeof(u64))));
+}
+
+constexpr Hasher128::Hasher128() noexcept : Hasher128{ 0 } {}
+
+constexpr Hasher128::Hasher128(u64 seed) noexcept :
+    h1_{ seed },
+    h2_{ seed },
+    buffer_{},
+    buffered_{ 0 },
+    total_{ 0 } {}
+
+constexpr void Hasher128::update(std::string_view data) noexcept {
+    const char *ptr  = data.data();
+    usize       len  = data.size();
+
+    total_          += len;
+
+    if (buffered_ != 0) {
+        const usize fill = std::min(len, impl::MUR_BLOCK - buffered_);
+        for (usize i = 0; i < fill; ++i) buffer_[buffered_ + i] = ptr[i];
+
+        buffered_ += fill;
+        ptr       += fill;
+        len       -= fill;
+
+        if (buffered_ < impl::MUR_BLOCK) return;
+
+        consume(buffer_.data());
+        buffered_ = 0;
+    }
+
+    for (; len >= impl::MUR_BLOCK; len -= impl::MUR_BLOCK) {
+        consume(ptr);
+        ptr += impl::MUR_BLOCK;
+    }
+
+    for (usize i = 0; i < len; ++i) buffer_[i] = ptr[i];
+    buffered_ = len;
+}
+
+constexpr Hash128 Hasher128::digest() const noexcept {
+    u64 h1 = h1_;
+    u64 h2 = h2_;
+    u64 k1 = 0;
+    u64 k2 = 0;
+
+    for (usize i = buffered_; i > sizeof(u64); --i)
+        k2 |= static_cast<u64>(impl::readU8(&buffer_[i - 1]))
+              << ((i - 1 - sizeof(u64)) * impl::BYTE_BITS);
+
+    for (usize i = std::min(buffered_, sizeof(u64)); i > 0; --i)
+        k1 |= static_cast<u64>(impl::readU8(&buffer_[i - 1]))
+              << ((i - 1) * impl::BYTE_BITS);
+
+    if (buffered_ > sizeof(u64)) {
+        k2 *= impl::MUR_C2;
+        k2  = std::rotl(k2, impl::MUR_K2_ROT);
+        k2 *= impl::MUR_C1;
+        h2 ^= k2;
+    }
+
+    if (buffered_ > 0) {
+        k1 *= impl::MUR_C1;
+        k1  = std::rotl(k1, impl::MUR_K1_ROT);
+        k1 *= impl::MUR_C2;
+        h1 ^= k1;
+    }
+
+    h1 ^= total_;
+    h2 ^= total_;
+
+    h1 += h2;
+    h2 += h1;
+
+    h1  = impl::murMix(h1);
+    h2  = impl::murMix(h2);
+
+    h1 += h2;
+    h2 += h1;
+
+    return { .low = h1, .high = h2 };
+}
+
+constexpr void Hasher128::consume(const char *ptr) noexcept {
+    u64 k1  = impl::readU64(ptr);
+    u64 k2  = impl::readU64(ptr + sizeof(u64));
+
+    k1     *= impl::MUR_C1;
+    k1      = std::rotl(k1, impl::MUR_K1_ROT);
+    k1     *= impl::MUR_C2;
+    h1_    ^= k1;
+
+    h1_     = std::rotl(h1_, impl::MUR_H1_ROT);
+    h1_    += h2_;
+    h1_     = (h1_ * impl::MUR_MUL) + impl::MUR_ADD_1;
+
+    k2     *= impl::MUR_C2;
+    k2      = std::rotl(k2, impl::MUR_K2_ROT);
+    k2     *= impl::MUR_C1;
+    h2_    ^= k2;
+
+    h2_     = std::rotl(h2_, impl::MUR_H2_ROT);
+    h2_    += h1_;
+    h2_     = (h2_ * impl::MUR_MUL) + impl::MUR_ADD_2;
+}
+
+constexpr u64 mix64(u64 val) noexcept { return impl::murMix(val); }
+
+constexpr u32 crc32c(std::string_view data) noexcept {
+    Crc32c crc{};
+    crc.update(data);
+    return crc.digest();
+}
+
+constexpr u64 hash64(std::string_view data) noexcept { return hash64(data, 0); }
+
+constexpr u64 hash64(std::string_view data, u64 seed) noexcept {
+    Hasher64 hasher{ seed };
+    hasher.update(data);
+    return hasher.digest();
+}
+
+constexpr Hash128 hash128(std::string_view data) noexcept {
+    return hash128(data, 0);
+}
+
+constexpr Hash128 hash128(std::string_view data, u64 seed) noexcept {
+    Hasher128 hasher{ seed };
+    hasher.update(data);
+    return hasher.digest();
+}
+
+} // namespace utils
+} // namespace srr
+
+#endif // SRR_UTILS_HASH_HPP
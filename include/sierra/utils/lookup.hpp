@@ -0,0 +1,226 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_UTILS_LOOKUP_HPP
+#define SRR_UTILS_LOOKUP_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/utils/hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string_view>
+
+inline namespace srr {
+namespace utils {
+
+template<usize N>
+class PerfectHash;
+
+namespace impl {
+
+constexpr u32 PHF_EMPTY     = U32_MAX;
+constexpr u32 PHF_MAX_SEED  = 1U << 20U;
+constexpr u64 PHF_SEED_MUL  = 0x9E37'79B9'7F4A'7C15;
+constexpr u64 PHF_MIX_MUL   = 0xBF58'476D'1CE4'E5B9;
+constexpr u32 PHF_MIX_SHIFT = 31;
+
+[[nodiscard]] static constexpr u64 phfMix(u64 hash, u32 seed) noexcept;
+
+// Deliberately not constexpr, reaching it during constant evaluation turns an
+// unresolvable key set (duplicate keys, colliding hashes) into a compile error.
+inline void                        phfUnresolvable() noexcept {}
+
+} // namespace impl
+
+template<usize N>
+[[nodiscard]] consteval PerfectHash<N> makePerfectHash(
+    const std::array<std::string_view, N> &keys) noexcept;
+
+// Perfect hash over a fixed key set built at compile time (hash and
+// displace). A lookup costs one hash, two table reads and a single key
+// comparison.
+template<usize N>
+class PerfectHash {
+public:
+    static constexpr usize MISS    = N;
+    static constexpr usize SLOTS   = std::bit_ceil(N + (N / 4) + 1);
+    static constexpr usize BUCKETS = std::bit_ceil(std::max<usize>(N / 2, 1));
+
+    [[nodiscard]] consteval explicit PerfectHash(
+        const std::array<std::string_view, N> &keys) noexcept;
+
+    [[nodiscard]] constexpr usize            size() const noexcept;
+    [[nodiscard]] constexpr std::string_view key(usize idx) const noexcept;
+
+    [[nodiscard]] constexpr usize indexOf(std::string_view key) const noexcept;
+    [[nodiscard]] constexpr bool  contains(std::string_view key) const noexcept;
+
+    [[nodiscard]] inline Result<usize> find(
+        std::string_view key) const noexcept;
+
+private:
+    std::array<std::string_view, N> keys_;
+    std::array<u32, SLOTS>          slots_;
+    std::array<u32, BUCKETS>        seeds_;
+};
+
+namespace impl {
+
+static constexpr u64 phfMix(u64 hash, u32 seed) noexcept {
+    u64 mixed  = hash ^ (seed * PHF_SEED_MUL);
+    mixed     *= PHF_MIX_MUL;
+    return mixed ^ (mixed >> PHF_MIX_SHIFT);
+}
+
+} // namespace impl
+
+template<usize N>
+consteval PerfectHash<N> makePerfectHash(
+    const std::array<std::string_view, N> &keys) noexcept {
+    return PerfectHash<N>{ keys };
+}
+
+template<usize N>
+consteval PerfectHash<N>::PerfectHash(
+    const std::array<std::string_view, N> &keys) noexcept :
+    keys_{ keys },
+    slots_{},
+    seeds_{} {
+    slots_.fill(impl::PHF_EMPTY);
+
+    std::array<u64, N>             hashes{};
+    std::array<usize, BUCKETS + 1> offsets{};
+    std::array<u32, N>             members{};
+
+    for (usize i = 0; i < N; ++i) {
+        hashes[i] = hash64(keys[i]);
+        ++offsets[(hashes[i] & (BUCKETS - 1)) + 1];
+    }
+
+    usize largest = 0;
+    for (usize b = 0; b < BUCKETS; ++b) {
+        largest         = std::max(largest, offsets[b + 1]);
+        offsets[b + 1] += offsets[b];
+    }
+
+    std::array<usize, BUCKETS> cursor{};
+    for (usize b = 0; b < BUCKETS; ++b) cursor[b] = offsets[b];
+
+    for (usize i = 0; i < N; ++i)
+        members[cursor[hashes[i] & (BUCKETS - 1)]++] = static_cast<u32>(i);
+
+    // Place the fullest buckets first while the table is still sparse.
+    for (usize size = largest; size > 0; --size) {
+        for (usize b = 0; b < BUCKETS; ++b) {
+            if (offsets[b + 1] - offsets[b] != size) continue;
+
+            for (usize i = offsets[b]; i < offsets[b + 1]; ++i) {
+                for (usize j = i + 1; j < offsets[b + 1]; ++j) {
+                    if (hashes[members[i]] != hashes[members[j]]) continue;
+
+                    impl::phfUnresolvable();
+                    return;
+                }
+            }
+
+            for (u32 seed = 1;; ++seed) {
+                if (seed > impl::PHF_MAX_SEED) {
+                    impl::phfUnresolvable();
+                    return;
+                }
+
+                usize placed = 0;
+                for (; placed < size; ++placed) {
+                    const u32   member = members[offsets[b] + placed];
+                    const usize slot =
+                        impl::phfMix(hashes[member], seed) & (SLOTS - 1);
+
+                    if (slots_[slot] != impl::PHF_EMPTY) break;
+                    slots_[slot] = member;
+                }
+
+                if (placed == size) {
+                    seeds_[b] = seed;
+                    break;
+                }
+
+                for (usize undo = 0; undo < placed; ++undo) {
+                    const u32   member = members[offsets[b] + undo];
+                    const usize slot =
+                        impl::phfMix(hashes[member], seed) & (SLOTS - 1);
+                    slots_[slot] = impl::PHF_EMPTY;
+                }
+            }
+        }
+    }
+}
+
+template<usize N>
+constexpr usize PerfectHash<N>::size() const noexcept {
+    return N;
+}
+
+template<usize N>
+constexpr std::string_view PerfectHash<N>::key(usize idx) const noexcept {
+    return keys_[idx];
+}
+
+template<usize N>
+constexpr usize PerfectHash<N>::indexOf(std::string_view key) const noexcept {
+    const u64 hash = hash64(key);
+    const u32 seed = seeds_[hash & (BUCKETS - 1)];
+    const u32 idx  = slots_[impl::phfMix(hash, seed) & (SLOTS - 1)];
+
+    if (idx == impl::PHF_EMPTY || keys_[idx] != key) return MISS;
+
+    return idx;
+}
+
+template<usize N>
+constexpr bool PerfectHash<N>::contains(std::string_view key) const noexcept {
+    return indexOf(key) != MISS;
+}
+
+template<usize N>
+inline Result<usize> PerfectHash<N>::find(
+    std::string_view key) const noexcept {
+    const usize idx = indexOf(key);
+    if (idx == MISS) return Err::NO_SUCH_KEY;
+
+    return idx;
+}
+
+} // namespace utils
+} // namespace srr
+
+#endif // SRR_UTILS_LOOKUP_HPP
@@ -56,6 +56,15 @@ concept SafeMovePolicy = Moveable<T> && SafeMoveable<T>;
 template<typename T>
 concept SafeCopyPolicy = !Copyable<T> || SafeCopyable<T>;
 
+// Opt-in marker for types that may be moved with memcpy and the source
+// forgotten, specialize for types that are not trivially copyable.
+template<typename T>
+struct TriviallyRelocatable :
+    std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template<typename T>
+concept Relocatable = TriviallyRelocatable<T>::value;
+
 } // namespace utils
 } // namespace srr
 
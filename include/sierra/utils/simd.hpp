@@ -0,0 +1,338 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_UTILS_SIMD_HPP
+#define SRR_UTILS_SIMD_HPP
+
+#include "sierra/prims.hpp"
+#include "sierra/target.hpp"
+
+#if defined(SRR_SIMD_SSSE3)
+    #include <tmmintrin.h>
+#elif defined(SRR_SIMD_NEON)
+    #include <arm_neon.h>
+#endif // SRR_SIMD_SSSE3
+
+#include <array>
+#include <cstring>
+
+inline namespace srr {
+namespace utils {
+
+constexpr usize SIMD_WIDTH = 16;
+
+using Lanes                = std::array<u8, SIMD_WIDTH>;
+
+struct U8x16 {
+#if defined(SRR_SIMD_SSSE3)
+    using Native = __m128i;
+#elif defined(SRR_SIMD_NEON)
+    using Native = uint8x16_t;
+#else
+    using Native = Lanes;
+#endif // SRR_SIMD_SSSE3
+
+    Native raw;
+
+    [[nodiscard]] inline static U8x16 load(const u8 *ptr) noexcept;
+    [[nodiscard]] inline static U8x16 load(const char *ptr) noexcept;
+    [[nodiscard]] inline static U8x16 load(const Lanes &lanes) noexcept;
+    [[nodiscard]] inline static U8x16 splat(u8 val) noexcept;
+
+    // Concatenates last:cur and extracts the 16 bytes starting N bytes before
+    // cur, i.e. lane i holds the byte that preceded cur[i] by N positions.
+    template<usize N>
+    [[nodiscard]] inline static U8x16 prev(U8x16 cur, U8x16 last) noexcept;
+
+    inline void                       store(u8 *ptr) const noexcept;
+    inline void                       store(char *ptr) const noexcept;
+
+    [[nodiscard]] inline U8x16        eq(U8x16 rhs) const noexcept;
+    [[nodiscard]] inline U8x16        bitAnd(U8x16 rhs) const noexcept;
+    [[nodiscard]] inline U8x16        bitOr(U8x16 rhs) const noexcept;
+    [[nodiscard]] inline U8x16        bitXor(U8x16 rhs) const noexcept;
+    [[nodiscard]] inline U8x16        subSat(U8x16 rhs) const noexcept;
+    [[nodiscard]] inline U8x16        shr4() const noexcept;
+
+    // Table lookup, every lane of idx must be in [0, 16).
+    [[nodiscard]] inline U8x16        lookup(U8x16 idx) const noexcept;
+
+    // One bit per lane, set when the lane's high bit is set.
+    [[nodiscard]] inline u32          mask() const noexcept;
+    [[nodiscard]] inline bool         any() const noexcept;
+};
+
+#if defined(SRR_SIMD_SSSE3)
+
+// SSE loads take a __m128i pointer but do not require alignment, reading
+// through it is the documented way to issue an unaligned load.
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+inline U8x16 U8x16::load(const u8 *ptr) noexcept {
+    return { _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)) };
+}
+
+inline U8x16 U8x16::load(const char *ptr) noexcept {
+    return { _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)) };
+}
+
+inline void U8x16::store(u8 *ptr) const noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), raw);
+}
+
+inline void U8x16::store(char *ptr) const noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), raw);
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+inline U8x16 U8x16::splat(u8 val) noexcept {
+    return { _mm_set1_epi8(static_cast<char>(val)) };
+}
+
+template<usize N>
+inline U8x16 U8x16::prev(U8x16 cur, U8x16 last) noexcept {
+    return { _mm_alignr_epi8(cur.raw, last.raw, SIMD_WIDTH - N) };
+}
+
+inline U8x16 U8x16::eq(U8x16 rhs) const noexcept {
+    return { _mm_cmpeq_epi8(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::bitAnd(U8x16 rhs) const noexcept {
+    return { _mm_and_si128(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::bitOr(U8x16 rhs) const noexcept {
+    return { _mm_or_si128(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::bitXor(U8x16 rhs) const noexcept {
+    return { _mm_xor_si128(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::subSat(U8x16 rhs) const noexcept {
+    return { _mm_subs_epu8(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::shr4() const noexcept {
+    constexpr u8 LOW_NIBBLE = 0x0F;
+    return { _mm_and_si128(_mm_srli_epi16(raw, 4),
+                           _mm_set1_epi8(static_cast<char>(LOW_NIBBLE))) };
+}
+
+inline U8x16 U8x16::lookup(U8x16 idx) const noexcept {
+    return { _mm_shuffle_epi8(raw, idx.raw) };
+}
+
+inline u32 U8x16::mask() const noexcept {
+    return static_cast<u32>(_mm_movemask_epi8(raw));
+}
+
+inline bool U8x16::any() const noexcept {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(raw, _mm_setzero_si128())) !=
+           static_cast<i32>(U16_MAX);
+}
+
+#elif defined(SRR_SIMD_NEON)
+
+inline U8x16 U8x16::load(const u8 *ptr) noexcept { return { vld1q_u8(ptr) }; }
+
+inline U8x16 U8x16::load(const char *ptr) noexcept {
+    // char and unsigned char may alias each other
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return { vld1q_u8(reinterpret_cast<const u8 *>(ptr)) };
+}
+
+inline void  U8x16::store(u8 *ptr) const noexcept { vst1q_u8(ptr, raw); }
+
+inline void  U8x16::store(char *ptr) const noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    vst1q_u8(reinterpret_cast<u8 *>(ptr), raw);
+}
+
+inline U8x16 U8x16::splat(u8 val) noexcept { return { vdupq_n_u8(val) }; }
+
+template<usize N>
+inline U8x16 U8x16::prev(U8x16 cur, U8x16 last) noexcept {
+    return { vextq_u8(last.raw, cur.raw, SIMD_WIDTH - N) };
+}
+
+inline U8x16 U8x16::eq(U8x16 rhs) const noexcept {
+    return { vceqq_u8(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::bitAnd(U8x16 rhs) const noexcept {
+    return { vandq_u8(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::bitOr(U8x16 rhs) const noexcept {
+    return { vorrq_u8(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::bitXor(U8x16 rhs) const noexcept {
+    return { veorq_u8(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::subSat(U8x16 rhs) const noexcept {
+    return { vqsubq_u8(raw, rhs.raw) };
+}
+
+inline U8x16 U8x16::shr4() const noexcept { return { vshrq_n_u8(raw, 4) }; }
+
+inline U8x16 U8x16::lookup(U8x16 idx) const noexcept {
+    return { vqtbl1q_u8(raw, idx.raw) };
+}
+
+inline u32 U8x16::mask() const noexcept {
+    constexpr Lanes   SHIFTS{ 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+    constexpr u32     HIGH_HALF = 8;
+
+    const uint8x16_t  bits      = vshrq_n_u8(raw, 7);
+    const uint8x16_t  weighted  = vshlq_u8(
+        bits, vreinterpretq_s8_u8(vld1q_u8(SHIFTS.data())));
+
+    const u32         low       = vaddv_u8(vget_low_u8(weighted));
+    const u32         high      = vaddv_u8(vget_high_u8(weighted));
+
+    return low | (high << HIGH_HALF);
+}
+
+inline bool U8x16::any() const noexcept { return vmaxvq_u8(raw) != 0; }
+
+#else // SRR_SIMD_SSSE3
+
+inline U8x16 U8x16::load(const u8 *ptr) noexcept {
+    U8x16 vec{};
+    std::memcpy(vec.raw.data(), ptr, SIMD_WIDTH);
+    return vec;
+}
+
+inline U8x16 U8x16::load(const char *ptr) noexcept {
+    U8x16 vec{};
+    std::memcpy(vec.raw.data(), ptr, SIMD_WIDTH);
+    return vec;
+}
+
+inline void U8x16::store(u8 *ptr) const noexcept {
+    std::memcpy(ptr, raw.data(), SIMD_WIDTH);
+}
+
+inline void U8x16::store(char *ptr) const noexcept {
+    std::memcpy(ptr, raw.data(), SIMD_WIDTH);
+}
+
+inline U8x16 U8x16::splat(u8 val) noexcept {
+    U8x16 vec{};
+    vec.raw.fill(val);
+    return vec;
+}
+
+template<usize N>
+inline U8x16 U8x16::prev(U8x16 cur, U8x16 last) noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        vec.raw[i] = i < N ? last.raw[SIMD_WIDTH - N + i] : cur.raw[i - N];
+    return vec;
+}
+
+inline U8x16 U8x16::eq(U8x16 rhs) const noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        vec.raw[i] = raw[i] == rhs.raw[i] ? U8_MAX : u8{ 0 };
+    return vec;
+}
+
+inline U8x16 U8x16::bitAnd(U8x16 rhs) const noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        vec.raw[i] = static_cast<u8>(raw[i] & rhs.raw[i]);
+    return vec;
+}
+
+inline U8x16 U8x16::bitOr(U8x16 rhs) const noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        vec.raw[i] = static_cast<u8>(raw[i] | rhs.raw[i]);
+    return vec;
+}
+
+inline U8x16 U8x16::bitXor(U8x16 rhs) const noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        vec.raw[i] = static_cast<u8>(raw[i] ^ rhs.raw[i]);
+    return vec;
+}
+
+inline U8x16 U8x16::subSat(U8x16 rhs) const noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        vec.raw[i] = raw[i] > rhs.raw[i] ? static_cast<u8>(raw[i] - rhs.raw[i])
+                                         : u8{ 0 };
+    return vec;
+}
+
+inline U8x16 U8x16::shr4() const noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        vec.raw[i] = static_cast<u8>(raw[i] >> 4);
+    return vec;
+}
+
+inline U8x16 U8x16::lookup(U8x16 idx) const noexcept {
+    U8x16 vec{};
+    for (usize i = 0; i < SIMD_WIDTH; ++i) vec.raw[i] = raw[idx.raw[i]];
+    return vec;
+}
+
+inline u32 U8x16::mask() const noexcept {
+    constexpr u8 HIGH_BIT = 7;
+
+    u32          bits     = 0;
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        bits |= static_cast<u32>(raw[i] >> HIGH_BIT) << i;
+    return bits;
+}
+
+inline bool U8x16::any() const noexcept {
+    for (usize i = 0; i < SIMD_WIDTH; ++i)
+        if (raw[i] != 0) return true;
+    return false;
+}
+
+#endif // SRR_SIMD_SSSE3
+
+inline U8x16 U8x16::load(const Lanes &lanes) noexcept {
+    return load(lanes.data());
+}
+
+} // namespace utils
+} // namespace srr
+
+#endif // SRR_UTILS_SIMD_HPP
@@ -0,0 +1,506 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Echo Engine Project - Apache 2.0 License
+ *
+ * Part of the Echo Engine Project, a modular C++ engine designed for
+ * flexibility, maintainability, and scalability.
+ *
+ * To ensure consistency across all modules, the Sierra Style Guide establishes
+ * comprehensive coding conventions, formatting rules, and tooling
+ * configurations. This includes rules for C++ formatting, language server
+ * behavior, static analysis, and guidelines for naming, structure and module
+ * interaction.
+ *
+ * All contributors are expected to adhere to the Sierra Style Guide,
+ * ensuring that code across the entire ecosystem is readable, maintainable,
+ * and compatible with the project’s tools and pipelines.
+ *
+ * By following these conventions, developers help maintain a cohesive
+ * and professional codebase across the Echo Engine Project.
+ *
+ * - https://echoengine.org
+ * - https://docs.echoengine.org
+ * - https://style.echoengine.org
+ *
+ * Module : Sierra - Shared
+ * Copyright (c) 2026 Echo Engine Project contributors
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef SRR_UTILS_UTF8_HPP
+#define SRR_UTILS_UTF8_HPP
+
+#include "sierra/error.hpp"
+#include "sierra/prims.hpp"
+#include "sierra/result.hpp"
+#include "sierra/status.hpp"
+#include "sierra/utils/simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+inline namespace srr {
+namespace utils {
+
+[[nodiscard]] inline Status        validateUtf8(std::string_view text) noexcept;
+
+// Offset of the first byte of the first invalid sequence, the text size when
+// text is valid. Meant for reporting after validateUtf8() failed.
+[[nodiscard]] inline usize         findInvalidUtf8(
+    std::string_view text) noexcept;
+
+[[nodiscard]] inline Result<usize> countCodepoints(
+    std::string_view text) noexcept;
+
+[[nodiscard]] inline Result<usize> lengthUtf16(std::string_view text) noexcept;
+
+[[nodiscard]] inline Result<usize> toUtf16(std::string_view    text,
+                                           std::span<char16_t> out) noexcept;
+
+[[nodiscard]] inline Result<usize> toUtf32(std::string_view    text,
+                                           std::span<char32_t> out) noexcept;
+
+namespace impl {
+
+// Error classes of the Keiser-Lemire lookup validator, each table maps a
+// nibble to the set of errors that nibble makes possible. A byte pair is
+// invalid when all three lookups agree on at least one class.
+constexpr u8    UTF8_TOO_SHORT       = 1U << 0U;
+constexpr u8    UTF8_TOO_LONG        = 1U << 1U;
+constexpr u8    UTF8_OVERLONG_3      = 1U << 2U;
+constexpr u8    UTF8_TOO_LARGE       = 1U << 3U;
+constexpr u8    UTF8_SURROGATE       = 1U << 4U;
+constexpr u8    UTF8_OVERLONG_2      = 1U << 5U;
+constexpr u8    UTF8_TOO_LARGE_1000  = 1U << 6U;
+constexpr u8    UTF8_OVERLONG_4      = 1U << 6U;
+constexpr u8    UTF8_TWO_CONTS       = 1U << 7U;
+constexpr u8    UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS;
+
+constexpr u8    UTF8_LOW_NIBBLE      = 0x0F;
+constexpr u8    UTF8_HIGH_BIT        = 0x80;
+constexpr u8    UTF8_CONT_MASK       = 0xC0;
+constexpr u8    UTF8_CONT_TAG        = 0x80;
+constexpr u8    UTF8_LEAD_2          = 0xC0;
+constexpr u8    UTF8_LEAD_3          = 0xE0;
+constexpr u8    UTF8_LEAD_4          = 0xF0;
+constexpr u8    UTF8_CONT_PAYLOAD    = 0x3F;
+constexpr u8    UTF8_LEAD_2_PAYLOAD  = 0x1F;
+constexpr u8    UTF8_LEAD_3_PAYLOAD  = 0x0F;
+constexpr u8    UTF8_LEAD_4_PAYLOAD  = 0x07;
+constexpr u32   UTF8_CONT_BITS       = 6;
+
+constexpr u32   UTF16_SUPPLEMENTARY  = 0x1'0000;
+constexpr u32   UTF16_HIGH_SURROGATE = 0xD800;
+constexpr u32   UTF16_LOW_SURROGATE  = 0xDC00;
+constexpr u32   UTF16_SURROGATE_BITS = 10;
+constexpr u32   UTF16_SURROGATE_MASK = 0x3FF;
+
+constexpr usize UTF8_UNROLL          = 4;
+constexpr usize UTF8_MAX_LENGTH      = 4;
+constexpr usize UTF8_FIND_CHUNK      = 4096;
+
+constexpr Lanes UTF8_BYTE_1_HIGH{
+    // 0___ ASCII
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    // 10__ continuation
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    // 1100 two byte lead
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    // 1101 two byte lead
+    UTF8_TOO_SHORT,
+    // 1110 three byte lead
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    // 1111 four byte lead
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+constexpr Lanes UTF8_BYTE_1_LOW{
+    // ____0000
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    // ____0001
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    // ____001_
+    UTF8_CARRY,
+    UTF8_CARRY,
+    // ____0100
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    // ____0101 to ____1100
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    // ____1101
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    // ____111_
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+};
+
+constexpr Lanes UTF8_BYTE_2_HIGH{
+    // 0___ ASCII
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    // 1000
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 |
+        UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    // 1001
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 |
+        UTF8_TOO_LARGE,
+    // 101_
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE |
+        UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE |
+        UTF8_TOO_LARGE,
+    // 11__ lead
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+};
+
+// Any lane above these bounds starts a sequence that needs more bytes than
+// remain in the block.
+constexpr Lanes UTF8_INCOMPLETE_MAX{
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    U8_MAX,
+    UTF8_LEAD_4 - 1,
+    UTF8_LEAD_3 - 1,
+    UTF8_LEAD_2 - 1,
+};
+
+struct Utf8Checker {
+    U8x16                       error;
+    U8x16                       prev_input;
+    U8x16                       prev_incomplete;
+
+    [[nodiscard]] inline static Utf8Checker make() noexcept;
+
+    inline void                 pushAscii(U8x16 input) noexcept;
+    inline void                 push(U8x16 input) noexcept;
+
+    [[nodiscard]] inline bool   failed() const noexcept;
+};
+
+template<typename F>
+[[nodiscard]] static bool scanUtf8(std::string_view text, F &&visit) noexcept;
+
+[[nodiscard]] static usize    sequenceLength(u8 lead) noexcept;
+[[nodiscard]] static char32_t decodeSequence(const char *ptr,
+                                             usize       len) noexcept;
+
+[[nodiscard]] static bool     isAsciiBlock(const char *ptr) noexcept;
+
+inline Utf8Checker Utf8Checker::make() noexcept {
+    const U8x16 zero = U8x16::splat(0);
+    return { .error = zero, .prev_input = zero, .prev_incomplete = zero };
+}
+
+inline void Utf8Checker::pushAscii(U8x16 input) noexcept {
+    error      = error.bitOr(prev_incomplete);
+    prev_input = input;
+}
+
+inline void Utf8Checker::push(U8x16 input) noexcept {
+    if (input.mask() == 0) {
+        pushAscii(input);
+        return;
+    }
+
+    const U8x16 prev1     = U8x16::prev<1>(input, prev_input);
+    const U8x16 prev2     = U8x16::prev<2>(input, prev_input);
+    const U8x16 prev3     = U8x16::prev<3>(input, prev_input);
+
+    const U8x16 low_mask  = U8x16::splat(UTF8_LOW_NIBBLE);
+    const U8x16 byte_1_hi = U8x16::load(UTF8_BYTE_1_HIGH).lookup(prev1.shr4());
+    const U8x16 byte_1_lo =
+        U8x16::load(UTF8_BYTE_1_LOW).lookup(prev1.bitAnd(low_mask));
+    const U8x16 byte_2_hi = U8x16::load(UTF8_BYTE_2_HIGH).lookup(input.shr4());
+    const U8x16 special   = byte_1_hi.bitAnd(byte_1_lo).bitAnd(byte_2_hi);
+
+    // Saturating subtraction leaves the high bit set only for lanes whose
+    // third (or fourth) predecessor is a three (or four) byte lead.
+    const U8x16 third =
+        prev2.subSat(U8x16::splat(UTF8_LEAD_3 - UTF8_HIGH_BIT));
+    const U8x16 fourth =
+        prev3.subSat(U8x16::splat(UTF8_LEAD_4 - UTF8_HIGH_BIT));
+    const U8x16 must_cont =
+        third.bitOr(fourth).bitAnd(U8x16::splat(UTF8_HIGH_BIT));
+
+    error           = error.bitOr(must_cont.bitXor(special));
+    prev_incomplete = input.subSat(U8x16::load(UTF8_INCOMPLETE_MAX));
+    prev_input      = input;
+}
+
+inline bool Utf8Checker::failed() const noexcept {
+    return error.bitOr(prev_incomplete).any();
+}
+
+template<typename F>
+static bool scanUtf8(std::string_view text, F &&visit) noexcept {
+    constexpr usize STRIDE  = SIMD_WIDTH * UTF8_UNROLL;
+
+    Utf8Checker     checker = Utf8Checker::make();
+    const char     *ptr     = text.data();
+    const usize     len     = text.size();
+    usize           pos     = 0;
+
+    for (; pos + STRIDE <= len; pos += STRIDE) {
+        const U8x16 b0 = U8x16::load(ptr + pos);
+        const U8x16 b1 = U8x16::load(ptr + pos + SIMD_WIDTH);
+        const U8x16 b2 = U8x16::load(ptr + pos + (SIMD_WIDTH * 2));
+        const U8x16 b3 = U8x16::load(ptr + pos + (SIMD_WIDTH * 3));
+
+        if (b0.bitOr(b1).bitOr(b2).bitOr(b3).mask() == 0) {
+            checker.pushAscii(b3);
+            continue;
+        }
+
+        checker.push(b0);
+        checker.push(b1);
+        checker.push(b2);
+        checker.push(b3);
+
+        visit(b0);
+        visit(b1);
+        visit(b2);
+        visit(b3);
+    }
+
+    for (; pos + SIMD_WIDTH <= len; pos += SIMD_WIDTH) {
+        const U8x16 block = U8x16::load(ptr + pos);
+        checker.push(block);
+        visit(block);
+    }
+
+    if (pos < len) {
+        Lanes tail{};
+        std::memcpy(tail.data(), ptr + pos, len - pos);
+
+        const U8x16 block = U8x16::load(tail);
+        checker.push(block);
+        visit(block);
+    }
+
+    return !checker.failed();
+}
+
+static usize sequenceLength(u8 lead) noexcept {
+    if (lead < UTF8_LEAD_2) return 1;
+    if (lead < UTF8_LEAD_3) return 2;
+    if (lead < UTF8_LEAD_4) return 3;
+    return 4;
+}
+
+static char32_t decodeSequence(const char *ptr, usize len) noexcept {
+    const u8 lead = static_cast<u8>(ptr[0]);
+
+    u32      code = 0;
+    switch (len) {
+    case 1 : return lead;
+    case 2 : code = lead & UTF8_LEAD_2_PAYLOAD; break;
+    case 3 : code = lead & UTF8_LEAD_3_PAYLOAD; break;
+    default: code = lead & UTF8_LEAD_4_PAYLOAD; break;
+    }
+
+    for (usize i = 1; i < len; ++i) {
+        const u8 cont = static_cast<u8>(ptr[i]);
+        code = (code << UTF8_CONT_BITS) | (cont & UTF8_CONT_PAYLOAD);
+    }
+
+    return code;
+}
+
+static bool isAsciiBlock(const char *ptr) noexcept {
+    return U8x16::load(ptr).mask() == 0;
+}
+
+} // namespace impl
+
+inline Status validateUtf8(std::string_view text) noexcept {
+    if (!impl::scanUtf8(text, []([[maybe_unused]] U8x16 block) {}))
+        return Err::INVALID_UTF8;
+
+    return {};
+}
+
+inline usize findInvalidUtf8(std::string_view text) noexcept {
+    usize pos = 0;
+
+    while (pos < text.size()) {
+        // Chunks end where a sequence starts, so each one validates on its
+        // own when the text is valid and only the failing one is walked.
+        usize end = std::min(pos + impl::UTF8_FIND_CHUNK, text.size());
+        for (usize back = 1; back < impl::UTF8_MAX_LENGTH; ++back) {
+            if (end == text.size()) break;
+            if ((static_cast<u8>(text[end]) & impl::UTF8_CONT_MASK) !=
+                impl::UTF8_CONT_TAG)
+                break;
+
+            --end;
+        }
+
+        if (validateUtf8(text.substr(pos, end - pos)).ok()) {
+            pos = end;
+            continue;
+        }
+
+        while (pos < end) {
+            const usize len = impl::sequenceLength(static_cast<u8>(text[pos]));
+            if (validateUtf8(text.substr(pos, len)).bad()) return pos;
+
+            pos += len;
+        }
+    }
+
+    return text.size();
+}
+
+inline Result<usize> countCodepoints(std::string_view text) noexcept {
+    const U8x16 cont_mask = U8x16::splat(impl::UTF8_CONT_MASK);
+    const U8x16 cont_tag  = U8x16::splat(impl::UTF8_CONT_TAG);
+
+    usize       conts     = 0;
+    const bool  valid     = impl::scanUtf8(text, [&](U8x16 block) {
+        conts += static_cast<usize>(
+            std::popcount(block.bitAnd(cont_mask).eq(cont_tag).mask()));
+    });
+
+    if (!valid) return Err::INVALID_UTF8;
+
+    return text.size() - conts;
+}
+
+inline Result<usize> lengthUtf16(std::string_view text) noexcept {
+    const U8x16 cont_mask = U8x16::splat(impl::UTF8_CONT_MASK);
+    const U8x16 cont_tag  = U8x16::splat(impl::UTF8_CONT_TAG);
+    const U8x16 lead_4    = U8x16::splat(impl::UTF8_LEAD_4);
+
+    usize       conts     = 0;
+    usize       pairs     = 0;
+    const bool  valid     = impl::scanUtf8(text, [&](U8x16 block) {
+        conts += static_cast<usize>(
+            std::popcount(block.bitAnd(cont_mask).eq(cont_tag).mask()));
+        pairs += static_cast<usize>(
+            std::popcount(block.bitAnd(lead_4).eq(lead_4).mask()));
+    });
+
+    if (!valid) return Err::INVALID_UTF8;
+
+    return text.size() - conts + pairs;
+}
+
+inline Result<usize> toUtf16(std::string_view    text,
+                             std::span<char16_t> out) noexcept {
+    const Status status = validateUtf8(text);
+    if (status.bad()) return status.err();
+
+    const char *ptr     = text.data();
+    const usize len     = text.size();
+    usize       pos     = 0;
+    usize       written = 0;
+
+    while (pos < len) {
+        if (pos + SIMD_WIDTH <= len && written + SIMD_WIDTH <= out.size() &&
+            impl::isAsciiBlock(ptr + pos)) {
+            for (usize i = 0; i < SIMD_WIDTH; ++i)
+                out[written + i] = static_cast<char16_t>(ptr[pos + i]);
+
+            pos     += SIMD_WIDTH;
+            written += SIMD_WIDTH;
+            continue;
+        }
+
+        const usize    seq  = impl::sequenceLength(static_cast<u8>(ptr[pos]));
+        const char32_t code = impl::decodeSequence(ptr + pos, seq);
+
+        if (code < impl::UTF16_SUPPLEMENTARY) {
+            if (written >= out.size()) return Err::INDEX_OUT_OF_RANGE;
+
+            out[written++] = static_cast<char16_t>(code);
+        } else {
+            if (written + 2 > out.size()) return Err::INDEX_OUT_OF_RANGE;
+
+            const u32 offset = code - impl::UTF16_SUPPLEMENTARY;
+            out[written++]   = static_cast<char16_t>(
+                impl::UTF16_HIGH_SURROGATE |
+                (offset >> impl::UTF16_SURROGATE_BITS));
+            out[written++] = static_cast<char16_t>(
+                impl::UTF16_LOW_SURROGATE |
+                (offset & impl::UTF16_SURROGATE_MASK));
+        }
+
+        pos += seq;
+    }
+
+    return written;
+}
+
+inline Result<usize> toUtf32(std::string_view    text,
+                             std::span<char32_t> out) noexcept {
+    const Status status = validateUtf8(text);
+    if (status.bad()) return status.err();
+
+    const char *ptr     = text.data();
+    const usize len     = text.size();
+    usize       pos     = 0;
+    usize       written = 0;
+
+    while (pos < len) {
+        if (pos + SIMD_WIDTH <= len && written + SIMD_WIDTH <= out.size() &&
+            impl::isAsciiBlock(ptr + pos)) {
+            for (usize i = 0; i < SIMD_WIDTH; ++i)
+                out[written + i] = static_cast<char32_t>(ptr[pos + i]);
+
+            pos     += SIMD_WIDTH;
+            written += SIMD_WIDTH;
+            continue;
+        }
+
+        if (written >= out.size()) return Err::INDEX_OUT_OF_RANGE;
+
+        const usize seq  = impl::sequenceLength(static_cast<u8>(ptr[pos]));
+        out[written++]   = impl::decodeSequence(ptr + pos, seq);
+        pos             += seq;
+    }
+
+    return written;
+}
+
+} // namespace utils
+} // namespace srr
+
+#endif // SRR_UTILS_UTF8_HPP